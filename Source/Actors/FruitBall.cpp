@@ -2,16 +2,27 @@
 #include "Components/StaticMeshComponent.h"
 #include "Gameplay/Fruit/FruitCollisionHelper.h"
 #include "Gameplay/Fruit/FruitMergeHelper.h"
+#include "Gameplay/Fruit/FruitRegistrySubsystem.h"
+#include "Gameplay/Fruit/FruitSpawnHelper.h"
+#include "Gameplay/Fruit/FruitPreviewComponent.h"
+#include "Gameplay/Fruit/FruitTypeCatalog.h"
+#include "Gameplay/Fruit/FruitPhysicsSchedulerSubsystem.h"
 #include "Engine/StaticMesh.h"
 #include "Gameplay/Controller/FruitPlayerController.h"
 #include "Kismet/GameplayStatics.h"
 #include "Interface/HUD/FruitHUD.h"
 #include "System/Camera/CameraOrbitFunctionLibrary.h"
 #include "Gameplay/Physics/FruitTrajectoryHelper.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Per-Fruit Tick"), STAT_FruitPerFruitTick, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Per-Fruit Tick Count"), STAT_FruitPerFruitTickCount, STATGROUP_FruitMountain);
 
 AFruitBall::AFruitBall()
 {
+    // 추락 감지는 레지스트리가 TG_PostPhysics에서 일괄 처리 (개별 틱은 비교용으로만 켬)
     PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = false;
     
     // 기본값 설정
     BallType = 1;
@@ -19,12 +30,12 @@ AFruitBall::AFruitBall()
     bSlowMotionActive = false;
     
     // 메시 컴포넌트 생성 및 루트로 설정
-    MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("FruitBallMesh"));
+    MeshComponent = CreateDefaultSubobject<UFruitMeshComponent>(TEXT("FruitBallMesh"));
     RootComponent = MeshComponent;
     
     // 물리 시뮬레이션 활성화
     MeshComponent->SetSimulatePhysics(true);
-    MeshComponent->SetCollisionProfileName(TEXT("PhysicsActor"));
+    MeshComponent->SetCollisionProfileName(FRUIT_COLLISION_PROFILE);
 
     // 생성자에서는 기본 메시(타입 1)를 로드 (나중에 UpdateFruitMesh에서 업데이트)
     static ConstructorHelpers::FObjectFinder<UStaticMesh> DefaultMeshAsset(TEXT("/Game/Fruit/Meshes/Fruit1"));
@@ -46,130 +57,253 @@ void AFruitBall::BeginPlay()
 {
     Super::BeginPlay();
     
+    // 풀에 보관하려고 만든 과일은 꺼낼 때 설정하고 바디를 만듦
+    if (bInPool)
+    {
+        return;
+    }
+    
+    // 레벨에 배치되었거나 SpawnActor로 바로 만든 과일은 현재 BallType으로 설정
+    if (!bSpawnConfigured)
+    {
+        ConfigureForSpawn(BallType, !bIsPreviewBall);
+    }
+    
+    // 설정이 모두 끝났으므로 바디를 한 번 생성
     if (MeshComponent)
     {
-        // 물리 시뮬레이션 확인
-        MeshComponent->SetSimulatePhysics(true);
-        
-        // 모든 채널에 대해 충돌 설정
-        MeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-        MeshComponent->SetCollisionObjectType(ECC_PhysicsBody);
-        
-        // 기본 PhysicsActor 프로필 사용
-        MeshComponent->SetCollisionProfileName(TEXT("PhysicsActor"));
-        
-        // 충돌 응답 수동 설정
-        MeshComponent->SetCollisionResponseToAllChannels(ECR_Block);
+        MeshComponent->FinishPhysicsState();
+    }
+    
+    // 과일 레지스트리에 등록 (주변 과일 검색, 추락 감지용)
+    if (UFruitRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UFruitRegistrySubsystem>())
+    {
+        Registry->RegisterFruit(this);
+    }
+    
+    SetActorTickEnabled(UFruitRegistrySubsystem::IsPerFruitFallTickEnabled());
+}
+
+void AFruitBall::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // 레지스트리에서 해제
+    if (UWorld* World = GetWorld())
+    {
+        if (UFruitRegistrySubsystem* Registry = World->GetSubsystem<UFruitRegistrySubsystem>())
+        {
+            Registry->UnregisterFruit(this);
+        }
+    }
+    
+    Super::EndPlay(EndPlayReason);
+}
+
+void AFruitBall::ConfigureForSpawn(int32 NewBallType, bool bEnablePhysics)
+{
+    bSpawnConfigured = true;
+    BallType = NewBallType;
+    bIsPreviewBall = !bEnablePhysics;
+    
+    // 크기 설정 - 모든 축에 동일한 스케일 적용
+    SetActorScale3D(FVector(UFruitSpawnHelper::CalculateBallSize(NewBallType)));
+    
+    if (!MeshComponent) return;
+    
+    // 바디가 아직 없으므로 아래 설정은 값만 바꾸고 바디를 다시 만들지 않음
+    ensure(!MeshComponent->IsPhysicsStateCreated());
+    
+    UpdateFruitMesh(NewBallType);
+    
+    // 과일 전용 프로필 사용 (오브젝트 타입 Fruit, 궤적 예측 채널만 무시하고 나머지는 모두 막음)
+    MeshComponent->SetCollisionProfileName(FRUIT_COLLISION_PROFILE);
+    MeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+    
+    // 충돌 이벤트 활성화
+    MeshComponent->SetNotifyRigidBodyCollision(true);
+    
+    // 질량, 감쇠
+    MeshComponent->SetMassOverrideInKg(NAME_None, CalculateBallMass(NewBallType));
+    MeshComponent->SetLinearDamping(0.0f);
+    MeshComponent->SetAngularDamping(0.0f);
+    
+    // 물리 활성화 설정 (미리보기 공은 물리/중력 없음)
+    MeshComponent->SetSimulatePhysics(bEnablePhysics);
+    MeshComponent->SetEnableGravity(bEnablePhysics);
+}
+
+void AFruitBall::OnCheckedOutFromPool(int32 NewBallType, bool bEnablePhysics)
+{
+    bInPool = false;
+    
+    // 상태 플래그 초기화
+    bIsPreviewBall = false;
+    bIsBeingMerged = false;
+    bHasCollided = false;
+    bSlowMotionActive = false;
+    GetWorldTimerManager().ClearTimer(GameOverTimerHandle);
+    
+    if (MeshComponent)
+    {
+        // 이전 사용 때 등록한 충돌 핸들러 제거 (SpawnBall에서 필요 시 다시 등록)
+        MeshComponent->OnComponentHit.RemoveDynamic(this, &AFruitBall::OnBallHit);
         
-        // 충돌 이벤트 활성화
-        MeshComponent->SetNotifyRigidBodyCollision(true);
+        // 반납 때 바디를 제거했으므로 설정을 모두 마친 뒤 한 번만 생성
+        MeshComponent->DeferPhysicsState();
+    }
+    
+    // 타입, 크기, 질량, 충돌, 물리 설정
+    ConfigureForSpawn(NewBallType, bEnablePhysics);
+    
+    if (MeshComponent)
+    {
+        MeshComponent->FinishPhysicsState();
+    }
+    
+    SetActorHiddenInGame(false);
+    SetActorTickEnabled(UFruitRegistrySubsystem::IsPerFruitFallTickEnabled());
+    
+    // 다시 레지스트리에 등록
+    if (UFruitRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UFruitRegistrySubsystem>())
+    {
+        Registry->RegisterFruit(this);
+    }
+}
+
+void AFruitBall::OnReturnedToPool(const FVector& ParkingLocation)
+{
+    bInPool = true;
+    bIsPreviewBall = false;
+    bIsBeingMerged = false;
+    GetWorldTimerManager().ClearTimer(GameOverTimerHandle);
+    
+    // 레지스트리에서 제외 (안정화, 추락 감지 대상 아님)
+    if (UFruitRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UFruitRegistrySubsystem>())
+    {
+        Registry->UnregisterFruit(this);
+    }
+    
+    // 이전 사용 때 예약된 감쇠/충돌 작업이 재사용된 과일에 적용되지 않도록 취소
+    if (UFruitPhysicsSchedulerSubsystem* Scheduler = GetWorld()->GetSubsystem<UFruitPhysicsSchedulerSubsystem>())
+    {
+        Scheduler->CancelAll(this);
+    }
+    
+    if (MeshComponent)
+    {
+        MeshComponent->OnComponentHit.RemoveDynamic(this, &AFruitBall::OnBallHit);
+        MeshComponent->SetSimulatePhysics(false);
+        MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
         
-        // 과일 메시 업데이트 (BeginPlay에서 현재 BallType으로 업데이트)
-        UpdateFruitMesh(BallType);
+        // 보관 중에는 바디를 두지 않음 (꺼낼 때 새 설정으로 한 번 생성)
+        MeshComponent->DeferPhysicsState();
     }
+    
+    // 숨기고 보관 위치로 이동
+    SetActorHiddenInGame(true);
+    SetActorTickEnabled(false);
+    SetActorLocation(ParkingLocation, false, nullptr, ETeleportType::ResetPhysics);
 }
 
 // 공 크기 계산 함수 구현 - 이미 언리얼 스케일로 반환
 float AFruitBall::CalculateBallSize(int32 BallType)
 {
-    // 과일 레벨에 따른 크기 선형 상수 증가 (UE 단위로 직접 반환)
-    // 레벨 1: 15cm, 레벨 2: 16.5cm, ...
-    return BaseBallSize + ((BallType - 1) * BaseBallSize * 0.2f);
+    // 과일 타입 테이블에서 조회 (UE 단위로 직접 반환)
+    return FFruitTypeTable::Get(BallType).Size;
 }
 
 // 공 질량 계산 함수 구현
 float AFruitBall::CalculateBallMass(int32 BallType)
 {
-    // 과일 레벨에 따른 질량 지수 증가 (예시 공식)
-    // 레벨 1: 100kg, 레벨 2: 102.5kg, ...
-    return DensityFactor * FMath::Pow(1.025f, BallType - 1);
+    // 과일 타입 테이블에서 조회
+    return FFruitTypeTable::Get(BallType).Mass;
 }
 
-// Tick 함수 수정 - 떨어짐 감지 시 카메라 이동 및 슬로우 모션 추가
+// Tick 함수 - 추락 감지는 UFruitRegistrySubsystem이 한 번에 처리하므로 비교용(Fruit.Fall.PerFruitTick 1)일 때만 사용
 void AFruitBall::Tick(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_FruitPerFruitTick);
+    INC_DWORD_STAT(STAT_FruitPerFruitTickCount);
+    
     Super::Tick(DeltaTime);
     
-    // 미리보기 공이나 병합 중인 과일은 체크하지 않음
-    if (bIsPreviewBall || bIsBeingMerged) return;
+    // 미리보기 공, 병합 중, 충돌 전 과일은 체크하지 않음
+    if (!IsFallCandidate()) return;
+    
+    // 접시보다 약간이라도 아래로 내려가면 게임 오버
+    if (GetActorLocation().Z < FallThreshold)
+    {
+        BeginFallSequence();
+    }
+}
+
+// 추락 처리 - 슬로우 모션, 카메라 이동 후 게임 오버
+void AFruitBall::BeginFallSequence()
+{
+    UE_LOG(LogTemp, Warning, TEXT("충돌 경험 있는 과일이 접시 바깥으로 떨어짐: %s (Z=%f)"), 
+        *GetName(), GetActorLocation().Z);
+                    
+    // Tick 비활성화
+    SetActorTickEnabled(false);
     
-    // 충돌 경험이 있는 과일만 추락 체크
-    if (bHasCollided)
+    // 이미 슬로우 모션 처리 중인지 확인
+    if (!bSlowMotionActive)
     {
-        // 현재 위치 확인
-        float CurrentZ = GetActorLocation().Z;
+        bSlowMotionActive = true;
+        
+        // 슬로우 모션 효과 적용
+        UGameplayStatics::SetGlobalTimeDilation(GetWorld(), 0.3f); // 30% 속도로 감속해 슬로우 모션
+        
+        // 1. 과일 자체의 물리 설정 변경
+        MeshComponent->SetLinearDamping(20.0f);
+        MeshComponent->SetAngularDamping(20.0f);
+        
+        // 2. 중력 영향 감소 (떨어지는 속도 감소)
+        MeshComponent->SetEnableGravity(false); // 중력 비활성화
+        
+        // 기존 속도의 방향을 유지하면서 속도 감소
+        FVector CurrentVelocity = MeshComponent->GetPhysicsLinearVelocity();
+        MeshComponent->SetPhysicsLinearVelocity(CurrentVelocity * 0.3f);
         
-        // 접시보다 약간이라도 아래로 내려가면 게임 오버
-        if (CurrentZ < FallThreshold)
+        // 수동으로 약한 낙하 속도 적용 (중력 없이 아래로 천천히 떨어짐)
+        FVector SlowFallVector = FVector(0, 0, -20.0f);
+        MeshComponent->AddForce(SlowFallVector, NAME_None, true);
+        
+        // 3. 카메라를 과일 쪽으로 이동
+        APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+        AFruitPlayerController* FruitController = Cast<AFruitPlayerController>(PC);
+
+        if (FruitController)
         {
-            UE_LOG(LogTemp, Warning, TEXT("충돌 경험 있는 과일이 접시 바깥으로 떨어짐: %s (Z=%f)"), 
-                *GetName(), CurrentZ);
-                            
-            // Tick 비활성화
-            SetActorTickEnabled(false);
-            
-            // 이미 슬로우 모션 처리 중인지 확인
-            if (!bSlowMotionActive)
+            // 미리보기 과일 숨기기
+            if (UFruitPreviewComponent* Preview = FruitController->GetPreviewComponent())
             {
-                bSlowMotionActive = true;
-                
-                // 슬로우 모션 효과 적용
-                UGameplayStatics::SetGlobalTimeDilation(GetWorld(), 0.3f); // 30% 속도로 감속해 슬로우 모션
-                
-                // 1. 과일 자체의 물리 설정 변경
-                MeshComponent->SetLinearDamping(20.0f);
-                MeshComponent->SetAngularDamping(20.0f);
-                
-                // 2. 중력 영향 감소 (떨어지는 속도 감소)
-                MeshComponent->SetEnableGravity(false); // 중력 비활성화
-                
-                // 기존 속도의 방향을 유지하면서 속도 감소
-                FVector CurrentVelocity = MeshComponent->GetPhysicsLinearVelocity();
-                MeshComponent->SetPhysicsLinearVelocity(CurrentVelocity * 0.3f);
-                
-                // 수동으로 약한 낙하 속도 적용 (중력 없이 아래로 천천히 떨어짐)
-                FVector SlowFallVector = FVector(0, 0, -20.0f);
-                MeshComponent->AddForce(SlowFallVector, NAME_None, true);
-                
-                // 3. 카메라를 과일 쪽으로 이동
-                APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-                AFruitPlayerController* FruitController = Cast<AFruitPlayerController>(PC);
-
-                if (FruitController)
+                Preview->HidePreview();
+            }
+            
+            // 궤적 표시 제거 - 실제 구현된 방식으로 호출
+            UFruitTrajectoryHelper::ResetTrajectorySystem(GetWorld());
+            
+            // 컨트롤러 입력 정지
+            FruitController->DisableInput(PC);
+            FruitController->bIsThrowingInProgress = false; // 던지기 상태 해제
+            
+            // 카메라 이동
+            UCameraOrbitFunctionLibrary::MoveViewToFallingFruit(FruitController, GetActorLocation(), FRotator::ZeroRotator);
+            
+            // 약간의 딜레이 후 실제 게임 오버 처리
+            GetWorld()->GetTimerManager().SetTimer(
+                GameOverTimerHandle,
+                [this, FruitController]()
                 {
-                    // 미리보기 공 제거
-                    if (FruitController->PreviewBall)
-                    {
-                        FruitController->PreviewBall->Destroy();
-                        FruitController->PreviewBall = nullptr;
-                    }
-                    
-                    // 궤적 표시 제거 - 실제 구현된 방식으로 호출
-                    UFruitTrajectoryHelper::ResetTrajectorySystem();
+                    // 게임 오버 처리
+                    FruitController->GameOver();
                     
-                    // 컨트롤러 입력 정지
-                    FruitController->DisableInput(PC);
-                    FruitController->bIsThrowingInProgress = false; // 던지기 상태 해제
-                    
-                    // 카메라 이동
-                    UCameraOrbitFunctionLibrary::MoveViewToFallingFruit(FruitController, GetActorLocation(), FRotator::ZeroRotator);
-                    
-                    // 약간의 딜레이 후 실제 게임 오버 처리
-                    GetWorld()->GetTimerManager().SetTimer(
-                        GameOverTimerHandle,
-                        [this, FruitController]()
-                        {
-                            // 게임 오버 처리
-                            FruitController->GameOver();
-                            
-                            // 시간 다시 정상화
-                            UGameplayStatics::SetGlobalTimeDilation(GetWorld(), 1.0f);
-                        },
-                        5.0f * UGameplayStatics::GetGlobalTimeDilation(GetWorld()), // 슬로우 모션 상태에서 5초
-                        false
-                    );
-                }
-            }
+                    // 시간 다시 정상화
+                    UGameplayStatics::SetGlobalTimeDilation(GetWorld(), 1.0f);
+                },
+                5.0f * UGameplayStatics::GetGlobalTimeDilation(GetWorld()), // 슬로우 모션 상태에서 5초
+                false
+            );
         }
     }
 }
@@ -185,29 +319,22 @@ void AFruitBall::UpdateFruitMesh(int32 NewBallType)
 {
     if (!MeshComponent) return;
     
-    // 메시 경로 생성: /Game/Fruit/Meshes/Fruit + BallType
-    FString MeshPath = FString::Printf(TEXT("/Game/Fruit/Meshes/Fruit%d"), NewBallType);
-    
-    // 새 메시 로드
-    UStaticMesh* NewMesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+    // 비동기로 로드된 메시 사용 (로드 중이면 nullptr)
+    UStaticMesh* NewMesh = FFruitTypeTable::Get(NewBallType).Mesh.Get();
     
     if (NewMesh)
     {
         // 새 메시 설정
-        MeshComponent->SetStaticMesh(NewMesh);
-        UE_LOG(LogTemp, Verbose, TEXT("과일 메시 업데이트: %s (타입: %d)"), *MeshPath, NewBallType);
+        if (MeshComponent->GetStaticMesh() != NewMesh)
+        {
+            MeshComponent->SetStaticMesh(NewMesh);
+        }
+        UE_LOG(LogTemp, Verbose, TEXT("과일 메시 업데이트: 타입 %d"), NewBallType);
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("메시를 찾을 수 없음: %s"), *MeshPath);
-        
-        // fallback 메시 - 기본 과일1 시도
-        UStaticMesh* FallbackMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Game/Fruit/Meshes/Fruit1"));
-        if (FallbackMesh)
-        {
-            MeshComponent->SetStaticMesh(FallbackMesh);
-            UE_LOG(LogTemp, Warning, TEXT("대체 메시 사용: Fruit1"));
-        }
+        // 아직 로드 중이면 현재 메시(기본 Fruit1)를 유지하고, 로드 완료 시 UFruitAssetSubsystem이 다시 갱신
+        UE_LOG(LogTemp, Verbose, TEXT("과일 메시 로드 대기 중: 타입 %d - 현재 메시 유지"), NewBallType);
     }
 }
 
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Gameplay/Fruit/FruitMeshComponent.h"
 #include "FruitBall.generated.h"
 
 UCLASS()
@@ -14,11 +15,13 @@ public:
     
     virtual void BeginPlay() override;
     
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    
     virtual void Tick(float DeltaTime) override;
     
-    // 공의 메시 컴포넌트
+    // 공의 메시 컴포넌트 (스폰 설정이 끝날 때까지 물리 바디 생성을 보류)
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components")
-    class UStaticMeshComponent* MeshComponent;
+    UFruitMeshComponent* MeshComponent;
     
     // 공 크기 getter 함수 - 외부에서 공 크기 접근용
     UFUNCTION(BlueprintCallable, Category="Ball Properties")
@@ -76,6 +79,25 @@ public:
     UFUNCTION()
     bool HasCollidedBefore() const { return bHasCollided; }
     
+    // 스폰 설정 - 타입 메시, 크기, 질량, 충돌 프로필, 시뮬레이션을 바디 생성 전에 한 번에 적용
+    // SpawnActorDeferred 후 FinishSpawning 전에 호출 (바디는 BeginPlay에서 한 번 생성)
+    void ConfigureForSpawn(int32 NewBallType, bool bEnablePhysics);
+    
+    // 풀에서 꺼낼 때 상태 초기화 (플래그, 충돌 핸들러) 후 스폰 설정을 적용하고 바디 생성
+    void OnCheckedOutFromPool(int32 NewBallType, bool bEnablePhysics);
+    
+    // 풀에 반납할 때 숨기고 물리를 끈 뒤 보관 위치로 이동
+    void OnReturnedToPool(const FVector& ParkingLocation);
+    
+    // 풀에 보관 중인지 여부
+    bool IsInPool() const { return bInPool; }
+    
+    // 추락 감지 대상 여부 (충돌 경험이 있고, 미리보기/병합/추락 처리 중이 아닌 과일)
+    bool IsFallCandidate() const { return bHasCollided && !bIsPreviewBall && !bIsBeingMerged && !bSlowMotionActive; }
+    
+    // 추락 처리 시작 (슬로우 모션, 카메라 이동, 게임 오버 예약)
+    void BeginFallSequence();
+    
     // 기본 공 크기 (월드 스케일)
     static constexpr float BaseBallSize = 15.0f;
     
@@ -107,10 +129,20 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Fruit")
     int32 BallType;
 
-protected:
-    // 안정화 타이머 핸들
-    FTimerHandle StabilizeTimerHandle;
+    // 과일 레지스트리 내 인덱스 (UFruitRegistrySubsystem에서만 관리)
+    int32 RegistryIndex = INDEX_NONE;
+
+    // 속도가 기준 이하로 유지된 시간 (UFruitRegistrySubsystem에서만 관리, 일정 시간 넘으면 재움)
+    float SettleTime = 0.0f;
+
+    // 풀 보관 여부
+    UPROPERTY()
+    bool bInPool = false;
+
+    // ConfigureForSpawn 적용 여부 (레벨에 배치되거나 바로 스폰된 과일은 BeginPlay에서 적용)
+    bool bSpawnConfigured = false;
 
+protected:
     // 슬로우 모션 활성화 여부
     UPROPERTY()
     bool bSlowMotionActive = false;
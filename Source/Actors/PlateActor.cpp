@@ -1,6 +1,7 @@
 #include "PlateActor.h"
 #include "Components/StaticMeshComponent.h"
 #include "UObject/ConstructorHelpers.h"
+#include "Gameplay/Physics/FruitPlateSubsystem.h"
 
 APlateActor::APlateActor()
 {
@@ -16,7 +17,7 @@ APlateActor::APlateActor()
     }
 
     // 테이블 메시 생성 및 설정
-    UStaticMeshComponent* TableMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("TableMesh"));
+    TableMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("TableMesh"));
     TableMesh->SetupAttachment(RootComponent);
     TableMesh->SetStaticMesh(TableAsset.Object);
     
@@ -36,7 +37,7 @@ APlateActor::APlateActor()
         return;
     }
 
-    UStaticMeshComponent* PlateMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("PlateMesh"));
+    PlateMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("PlateMesh"));
     PlateMesh->SetupAttachment(RootComponent);
     PlateMesh->SetStaticMesh(PlateAsset.Object);
     PlateMesh->SetWorldScale3D(PlateScale);
@@ -48,4 +49,25 @@ APlateActor::APlateActor()
 
     // 액터에 태그 추가
     Tags.Add(FName("Plate"));
+}
+
+void APlateActor::PostRegisterAllComponents()
+{
+    Super::PostRegisterAllComponents();
+
+    // 컴포넌트 바운드가 준비된 시점에 접시 모양 등록 (이후에는 트랜스폼이 바뀔 때만 다시 계산)
+    if (UFruitPlateSubsystem* PlateSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UFruitPlateSubsystem>() : nullptr)
+    {
+        PlateSubsystem->RegisterPlate(this);
+    }
+}
+
+void APlateActor::PostUnregisterAllComponents()
+{
+    if (UFruitPlateSubsystem* PlateSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UFruitPlateSubsystem>() : nullptr)
+    {
+        PlateSubsystem->UnregisterPlate(this);
+    }
+
+    Super::PostUnregisterAllComponents();
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "GameFramework/Actor.h"
 #include "PlateActor.generated.h"
 
+class UStaticMeshComponent;
+
 UCLASS()
 class UE_FRUITMOUNTAIN_API APlateActor : public AActor
 {
@@ -12,6 +14,14 @@ class UE_FRUITMOUNTAIN_API APlateActor : public AActor
 public:
     APlateActor();
 
+    //~ Begin AActor Interface
+    virtual void PostRegisterAllComponents() override;
+    virtual void PostUnregisterAllComponents() override;
+    //~ End AActor Interface
+
+    UStaticMeshComponent* GetPlateMesh() const { return PlateMesh; }
+    UStaticMeshComponent* GetTableMesh() const { return TableMesh; }
+
 public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Plate")
     FVector PlateScale = FVector(12.f, 12.f, 5.f);
@@ -19,4 +29,13 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Plate")
     //FVector PlateLocation = FVector(0.f, -10.f, 30.f);
     FVector PlateLocation = FVector(0.f, 0.f, 30.f);
+
+private:
+    // 테이블 메시 (전체 바운드에 포함)
+    UPROPERTY(VisibleAnywhere, Category="Plate")
+    TObjectPtr<UStaticMeshComponent> TableMesh;
+
+    // 순수 접시 메시 (스폰 원 반지름 계산용)
+    UPROPERTY(VisibleAnywhere, Category="Plate")
+    TObjectPtr<UStaticMeshComponent> PlateMesh;
 };
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "Camera/CameraComponent.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Components/SceneComponent.h"
+#include "Gameplay/Physics/FruitTrajectoryRenderComponent.h"
+#include "Gameplay/Fruit/FruitPreviewComponent.h"
 
 APlayerPawn::APlayerPawn()
 {
@@ -27,6 +29,14 @@ APlayerPawn::APlayerPawn()
     CurrentRotation.Pitch -= 20.f;
     
     CameraComponent->SetRelativeRotation(CurrentRotation);
+
+    // 궤적 렌더 컴포넌트 (월드 좌표로 그리므로 카메라 이동과 무관)
+    TrajectoryRenderComponent = CreateDefaultSubobject<UFruitTrajectoryRenderComponent>(TEXT("TrajectoryRenderComponent"));
+    TrajectoryRenderComponent->SetupAttachment(RootComponent);
+
+    // 미리보기 과일 (월드 좌표로 배치하므로 카메라 이동과 무관)
+    PreviewComponent = CreateDefaultSubobject<UFruitPreviewComponent>(TEXT("PreviewComponent"));
+    PreviewComponent->SetupAttachment(RootComponent);
 }
 
 void APlayerPawn::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -17,4 +17,12 @@ public:
     // 카메라 컴포넌트
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     class UCameraComponent* CameraComponent;
+
+    // 궤적 미리보기 렌더 컴포넌트
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    class UFruitTrajectoryRenderComponent* TrajectoryRenderComponent;
+
+    // 던지기 미리보기 과일 (계속 유지하고 던지는 동안에는 숨김)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    class UFruitPreviewComponent* PreviewComponent;
 };
\ No newline at end of file
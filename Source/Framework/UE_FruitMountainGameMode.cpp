@@ -8,7 +8,9 @@
 #include "Interface/HUD/FruitHUD.h"
 #include "Interface/UI/TextureDisplayWidget.h"
 #include "Gameplay/Physics/FruitTrajectoryHelper.h"
+#include "Gameplay/Physics/FruitPlateSubsystem.h"
 #include "Gameplay/Fruit/FruitMergeHelper.h"
+#include "Gameplay/Fruit/FruitPoolSubsystem.h"
 #include "Logging/LogMacros.h"
 
 #if WITH_EDITOR
@@ -43,13 +45,19 @@ void AUE_FruitMountainGameMode::BeginPlay()
     // 게임 시작 시 모든 과일 메시 사전 로드
     UFruitMergeHelper::PreloadAllFruitMeshes(GetWorld());
     
+    // 던지기/미리보기/병합에 쓸 과일 액터 미리 생성
+    if (UFruitPoolSubsystem* Pool = GetWorld()->GetSubsystem<UFruitPoolSubsystem>())
+    {
+        Pool->Prewarm(FruitBallClass, UFruitPoolSubsystem::GetConfiguredPoolSize());
+    }
+    
     UTextureDisplayWidget::CreateDisplayWidget(this);
 }
 
 void AUE_FruitMountainGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     // 종료 시점에 정리
-    UFruitTrajectoryHelper::ResetTrajectorySystem();
+    UFruitTrajectoryHelper::ResetTrajectorySystem(GetWorld());
     
     Super::EndPlay(EndPlayReason);
 }
@@ -58,10 +66,8 @@ void AUE_FruitMountainGameMode::StartPlay()
 {
     Super::StartPlay();
 
-    // 레벨에 "Plate" 태그가 부여된 액터가 있는지 확인
-    TArray<AActor*> PlateActors;
-    UGameplayStatics::GetAllActorsWithTag(GetWorld(), FName("Plate"), PlateActors);
-    if (PlateActors.Num() == 0)
+    // 레벨에 배치된 접시는 컴포넌트 등록 시 접시 서브시스템에 등록되어 있음
+    if (!UFruitPlateSubsystem::Get(GetWorld()).bValid)
     {
         if (PlateClass)
         {
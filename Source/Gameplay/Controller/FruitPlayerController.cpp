@@ -7,8 +7,18 @@
 #include "Gameplay/Physics/FruitThrowHelper.h"
 #include "Gameplay/Physics/FruitTrajectoryHelper.h"
 #include "Gameplay/Physics/FruitPhysicsHelper.h"
+#include "Gameplay/Physics/FruitAsyncThrowSolver.h"
+#include "Gameplay/Physics/FruitPlateSubsystem.h"
 #include "Actors/FruitBall.h"
+#include "Gameplay/Fruit/FruitSpawnHelper.h"
+#include "Gameplay/Fruit/FruitPreviewComponent.h"
 #include "Interface/HUD/FruitHUD.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Preview Resolve"), STAT_FruitPreviewResolve, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Preview Recomputes"), STAT_FruitPreviewRecomputes, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Preview Location Recomputes"), STAT_FruitPreviewLocationRecomputes, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Preview Rotation Recomputes"), STAT_FruitPreviewRotationRecomputes, STATGROUP_FruitMountain);
 
 AFruitPlayerController::AFruitPlayerController()
 {
@@ -23,6 +33,9 @@ void AFruitPlayerController::BeginPlay()
 {
     Super::BeginPlay();
 
+    // 미리보기 궤적 계산용 비동기 솔버
+    ThrowSolver = MakeShared<FFruitAsyncThrowSolver, ESPMode::ThreadSafe>();
+
     // GameMode를 캐스팅하여 FruitBallClass 값을 가져옴
     AUE_FruitMountainGameMode* GM = Cast<AUE_FruitMountainGameMode>(UGameplayStatics::GetGameMode(GetWorld()));
     if (GM && GM->FruitBallClass)
@@ -35,39 +48,21 @@ void AFruitPlayerController::BeginPlay()
         UE_LOG(LogTemp, Warning, TEXT("GameMode의 FruitBallClass가 비어 있습니다."));
     }
 
-    // 타이머를 사용하여 약간의 지연 후 접시 액터 검색 (타이밍 문제 해결)
-    GetWorld()->GetTimerManager().SetTimerForNextTick([this]()
-    {
-        // 접시 액터를 검색하여 회전 기준 위치로 사용
-        TArray<AActor*> PlateActors;
-        UGameplayStatics::GetAllActorsWithTag(GetWorld(), FName("Plate"), PlateActors);
-        if (PlateActors.Num() > 0)
-        {
-            // 접시 경계 구하기 (중심점 정확히 계산)
-            FVector PlateOrigin;
-            FVector PlateExtent;
-            PlateActors[0]->GetActorBounds(false, PlateOrigin, PlateExtent);
-            PlateOrigin.Z += 10.0f; // 접시 표면 위로 약간 올림
-            
-            // 직접 중심점 설정 (오프셋 없이)
-            PlateLocation = PlateOrigin;
-            
-            UE_LOG(LogTemp, Warning, TEXT("접시 액터를 찾았습니다: %s"), *PlateLocation.ToString());
-            
-            // 카메라 위치 업데이트
-            UCameraOrbitFunctionLibrary::UpdateCameraOrbit(GetPawn(), PlateLocation, CameraOrbitAngle, CameraOrbitRadius);
-        }
-        else
-        {
-            PlateLocation = FVector::ZeroVector;
-            UE_LOG(LogTemp, Warning, TEXT("접시 액터를 찾을 수 없습니다."));
-            return;
-        }
-    });
+    // 접시는 게임 모드 StartPlay에서 생성될 수 있으므로 이후에는 ResolvePreview에서 접시 모양 리비전만 확인
+    RefreshPlateLocation();
 
-    // 미리보기 공 생성 시 회전까지 적용되도록 true 매개변수 추가
+    // 첫 미리보기는 위치, 타입, 회전 모두 계산
     CurrentBallType = FMath::RandRange(1, AFruitBall::RandomBallTypeMax);
-    UpdatePreviewBallWithDebounce();
+    MarkPreviewDirty(EFruitPreviewDirty::All);
+
+    // 입력(컨트롤러 틱)이 모두 처리된 뒤 물리 이후에 프레임당 한 번 미리보기 갱신
+    PreviewTickFunction.Setup(GetWorld(), TG_PostPhysics,
+        [this](float DeltaTime)
+        {
+            ResolvePreview();
+        },
+        TEXT("FruitPreviewResolve"));
+    PreviewTickFunction.AddPrerequisite(this, PrimaryActorTick);
 
     // 입력 매핑 설정
     UFruitInputMappingManager::ConfigureKeyMappings();
@@ -138,11 +133,10 @@ void AFruitPlayerController::ThrowFruit()
     // 던지기 시작 표시
     bIsThrowingInProgress = true;
     
-    // 미리보기 공 숨기기 - 제거하되 즉시 실제 공 생성
-    if (PreviewBall)
+    // 미리보기 과일 숨기기 - 제거하지 않고 다음 미리보기 때 다시 표시
+    if (UFruitPreviewComponent* Preview = GetPreviewComponent())
     {
-        PreviewBall->Destroy();
-        PreviewBall = nullptr;
+        Preview->HidePreview();
     }
     
     // 입력 비활성화 - 던지는 동안 모든 조작 막기
@@ -165,13 +159,106 @@ void AFruitPlayerController::ThrowFruit()
             
             // 새로운 미리보기 공 업데이트 (공 타입 바꾸기)
             CurrentBallType = FMath::RandRange(1, AFruitBall::RandomBallTypeMax); // 다음에 던질 공 타입 랜덤 변경
-            UpdatePreviewBallWithDebounce();
+            MarkPreviewDirty(EFruitPreviewDirty::BallType);
         },
         BallThrowDelay,
         false // 반복 실행 안 함
     );
 }
 
+void AFruitPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    PreviewTickFunction.Teardown();
+
+    // 진행 중인 궤적 계산은 결과만 버림 (작업은 솔버 공유 참조를 쥐고 있으므로 안전하게 끝남)
+    if (ThrowSolver.IsValid())
+    {
+        ThrowSolver->Cancel();
+        ThrowSolver.Reset();
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AFruitPlayerController::ResolvePreview()
+{
+    SCOPE_CYCLE_COUNTER(STAT_FruitPreviewResolve);
+
+    RefreshPlateLocation();
+
+    // 워커에서 끝난 던지기 해 반영 - 현재 입력 상태의 해면 위치/궤적 다시 계산
+    if (UFruitThrowHelper::PollAsyncThrowSolution(this))
+    {
+        MarkPreviewDirty(EFruitPreviewDirty::Solution);
+    }
+
+    // 던지는 동안에는 미리보기를 숨겨 두고, 쌓인 변경은 던지기가 끝난 뒤 처리
+    if (bIsThrowingInProgress)
+    {
+        return;
+    }
+
+    const EFruitPreviewDirty Dirty = PreviewDirty;
+    PreviewDirty = EFruitPreviewDirty::None;
+
+    if (Dirty == EFruitPreviewDirty::None)
+    {
+        // 입력이 그대로여도 과일 더미는 계속 바뀌므로 접촉 지점만 다시 확인 (던지기 해는 재사용, 바뀐 정점만 전송)
+        if (UFruitTrajectoryHelper::IsPileAwareEnabled())
+        {
+            UFruitTrajectoryHelper::UpdateTrajectoryPath(this);
+        }
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_FruitPreviewRecomputes);
+
+    // 위치, 타입, 궤적 (입력 상태가 캐시와 같으면 던지기 해는 재사용)
+    if (EnumHasAnyFlags(Dirty, EFruitPreviewDirty::Location))
+    {
+        INC_DWORD_STAT(STAT_FruitPreviewLocationRecomputes);
+        UFruitThrowHelper::UpdatePreviewBall(this, false);
+    }
+
+    // 과일이 항상 카메라를 바라보도록 회전 조정
+    if (EnumHasAnyFlags(Dirty, EFruitPreviewDirty::Rotation))
+    {
+        if (UFruitPreviewComponent* Preview = GetPreviewComponent())
+        {
+            INC_DWORD_STAT(STAT_FruitPreviewRotationRecomputes);
+            SetFruitRotation(Preview);
+        }
+    }
+}
+
+void AFruitPlayerController::RefreshPlateLocation()
+{
+    // 접시 모양이 그대로면 아무것도 하지 않음 (검색/바운드 계산 없음)
+    const FFruitPlateGeometry& Plate = UFruitPlateSubsystem::Get(GetWorld());
+    if (Plate.Revision == PlateRevision)
+    {
+        return;
+    }
+    PlateRevision = Plate.Revision;
+
+    if (!Plate.bValid)
+    {
+        PlateLocation = FVector::ZeroVector;
+        UE_LOG(LogTemp, Warning, TEXT("접시 액터를 찾을 수 없습니다."));
+        return;
+    }
+
+    // 접시 조준점을 회전 기준 위치로 사용
+    PlateLocation = Plate.AimLocation;
+    UE_LOG(LogTemp, Warning, TEXT("접시 액터를 찾았습니다: %s"), *PlateLocation.ToString());
+
+    // 카메라 위치 업데이트
+    UCameraOrbitFunctionLibrary::UpdateCameraOrbit(GetPawn(), PlateLocation, CameraOrbitAngle, CameraOrbitRadius);
+
+    // 던지기 해는 접시 리비전으로 다시 계산되므로 미리보기만 갱신 요청
+    MarkPreviewDirty(EFruitPreviewDirty::Plate);
+}
+
 // 새로운 각도 조정 함수 (축 매핑용)
 void AFruitPlayerController::AdjustAngle(float Value)
 {
@@ -197,8 +284,8 @@ void AFruitPlayerController::AdjustAngle(float Value)
     // 안전을 위한 클램핑 (불필요하지만 추가 보호)
     ThrowAngle = FMath::Clamp(ThrowAngle, UFruitPhysicsHelper::MinThrowAngle, UFruitPhysicsHelper::MaxThrowAngle);
     
-    // 각도 변경 후 미리보기 공 및 궤적 업데이트
-    UpdatePreviewBallWithDebounce();
+    // 각도 변경 후 미리보기 공 및 궤적 업데이트 (프레임 끝에 한 번)
+    MarkPreviewDirty(EFruitPreviewDirty::Angle);
 }
 
 // 카메라 회전 처리 함수 - 과일 회전 보정 수정
@@ -221,52 +308,18 @@ void AFruitPlayerController::RotateCamera(float Value)
     // 카메라 위치 업데이트
     UCameraOrbitFunctionLibrary::UpdateCameraOrbit(GetPawn(), PlateLocation, CameraOrbitAngle, CameraOrbitRadius);
     
-    // 위치만 업데이트하고 회전은 별도로 처리
-    UFruitThrowHelper::UpdatePreviewBall(this, false);
-    
-    // 과일이 항상 카메라를 바라보도록 회전 조정
-    if (PreviewBall)
-    {
-        SetFruitRotation(PreviewBall);
-    }
+    // 미리보기 위치와 회전은 프레임 끝에 한 번 갱신
+    MarkPreviewDirty(EFruitPreviewDirty::Yaw);
 }
 
-// 실제 업데이트 수행 함수 (무한 루프 방지 용으로 이중으로 거침)
-void AFruitPlayerController::ExecutePreviewBallUpdate()
-{
-    bPreviewBallUpdatePending = false;
-    
-    // 공 위치 업데이트 (회전은 별도 처리)
-    UFruitThrowHelper::UpdatePreviewBall(this, false);
-    
-    // 과일 각도 업데이트
-    if (PreviewBall)
-    {
-        SetFruitRotation(PreviewBall);
-    }
-}
-
-// 미리보기 공 업데이트 함수 - 연속 호출 방지 (디바운싱) 처리
-void AFruitPlayerController::UpdatePreviewBallWithDebounce()
+// 과일 회전 설정 함수 구현 - 항상 카메라 각도 고려
+UFruitPreviewComponent* AFruitPlayerController::GetPreviewComponent() const
 {
-    // 이미 업데이트가 예약되어 있으면 중복 실행하지 않음
-    if (!bPreviewBallUpdatePending)
-    {
-        bPreviewBallUpdatePending = true;
-        
-        // 타이머 설정: 일정 시간 후에만 업데이트 실행
-        GetWorld()->GetTimerManager().SetTimer(
-            PreviewBallUpdateTimerHandle,
-            this,
-            &AFruitPlayerController::ExecutePreviewBallUpdate,
-            PreviewBallUpdateDelay,
-            false // 반복 실행 안 함
-        );
-    }
+    APawn* ControlledPawn = GetPawn();
+    return ControlledPawn ? ControlledPawn->FindComponentByClass<UFruitPreviewComponent>() : nullptr;
 }
 
-// 과일 회전 설정 함수 구현 - 항상 카메라 각도 고려
-void AFruitPlayerController::SetFruitRotation(AActor* Fruit)
+void AFruitPlayerController::SetFruitRotation(USceneComponent* Fruit)
 {
     if (!Fruit)
     {
@@ -286,5 +339,5 @@ void AFruitPlayerController::SetFruitRotation(AActor* Fruit)
     
     // 새로운 회전 설정
     FRotator NewRotation = FRotator(PitchAngle, YawAngle, 0.0f);
-    Fruit->SetActorRotation(NewRotation);
+    Fruit->SetWorldRotation(NewRotation);
 }
\ No newline at end of file
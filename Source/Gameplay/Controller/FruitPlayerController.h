@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
+#include "Gameplay/Physics/FruitThrowSolution.h"
+#include "Gameplay/Controller/FruitPreviewDirty.h"
+#include "System/Tick/FruitTickFunction.h"
 #include "FruitPlayerController.generated.h"
 
 UCLASS()
@@ -13,6 +16,7 @@ public:
     AFruitPlayerController();
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // 게임 오버 처리 함수
     UFUNCTION(BlueprintCallable)
@@ -49,9 +53,8 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Orbit")
     float CameraOrbitRadius; // 접시와의 거리
     
-    // 미리보기 공 액터
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ball")
-    AActor* PreviewBall;
+    // 미리보기 과일 컴포넌트 (폰 소유, 폰이 없으면 nullptr)
+    class UFruitPreviewComponent* GetPreviewComponent() const;
 
     // 현재 선택된 공 타입 (1~11)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ball")
@@ -65,22 +68,38 @@ public:
     UPROPERTY(BlueprintReadOnly, Category="Plate")
     FVector PlateLocation;
 
-    // 미리보기 공 업데이트 함수
-    void UpdatePreviewBallWithDebounce();
+    // 현재 입력 상태의 던지기 해 (UFruitThrowHelper::ResolveThrowSolution으로 조회)
+    FFruitThrowSolution ThrowSolution;
+
+    // 접시 기준 던지기 결과 캐시 (카메라 회전은 회전 변환만 적용)
+    FFruitThrowSolutionCache ThrowSolutionCache;
+
+    // 미리보기 던지기 해를 워커 스레드에서 계산하는 솔버
+    TSharedPtr<class FFruitAsyncThrowSolver, ESPMode::ThreadSafe> ThrowSolver;
+
+    // 미리보기에 영향을 주는 입력이 바뀌었음을 표시 (같은 프레임의 표시는 모아서 프레임 끝에 한 번 처리)
+    void MarkPreviewDirty(EFruitPreviewDirty Flags) { PreviewDirty |= Flags; }
     
     // 과일 회전 설정 함수 - 던지기 각도와 카메라 각도 기반
-    void SetFruitRotation(AActor* Fruit);
+    void SetFruitRotation(USceneComponent* Fruit);
     
 private:
-    // 미리보기 공 업데이트 제한을 위한 변수들
-    FTimerHandle PreviewBallUpdateTimerHandle;
-    bool bPreviewBallUpdatePending = false;
-    const float PreviewBallUpdateDelay = 0.02f;
+    // 아직 반영하지 않은 미리보기 입력 변경
+    EFruitPreviewDirty PreviewDirty = EFruitPreviewDirty::None;
+
+    // 입력 처리(컨트롤러 틱) 이후 TG_PostPhysics에서 미리보기를 프레임당 한 번 갱신
+    FFruitTickFunction PreviewTickFunction;
+
+    // 마지막으로 반영한 접시 모양 리비전
+    uint32 PlateRevision = 0;
+
+    // 접시 모양이 바뀌었으면 조준점과 카메라 갱신
+    void RefreshPlateLocation();
     
     virtual void SetupInputComponent() override;
     
-    // 실제 업데이트 수행 함수
-    void ExecutePreviewBallUpdate();
+    // 표시된 입력 변경을 모아 바뀐 부분만 다시 계산 (PreviewTickFunction에서 호출)
+    void ResolvePreview();
 
     // 스페이스바 입력에 따라 과일을 던짐
     void ThrowFruit();
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 미리보기(과일 위치/타입/회전, 궤적)에 영향을 주는 입력
+ * 입력이 바뀐 곳에서는 표시만 하고, 컨트롤러가 프레임마다 한 번 모아서 바뀐 부분만 다시 계산
+ */
+enum class EFruitPreviewDirty : uint8
+{
+    None = 0,
+
+    // 던지기 각도
+    Angle = 1 << 0,
+
+    // 카메라 오빗 각도
+    Yaw = 1 << 1,
+
+    // 공 타입 (던진 뒤 미리보기를 다시 보일 때도 사용)
+    BallType = 1 << 2,
+
+    // 접시 모양 (FFruitPlateGeometry::Revision)
+    Plate = 1 << 3,
+
+    // 워커 스레드에서 현재 입력의 던지기 해가 도착
+    Solution = 1 << 4,
+
+    // 위치/타입/궤적은 던지기 해를 거치므로 모든 입력의 영향을 받음
+    Location = Angle | Yaw | BallType | Plate | Solution,
+
+    // 과일 회전은 던지기 각도와 카메라 각도만 사용
+    Rotation = Angle | Yaw,
+
+    All = Location | Rotation
+};
+ENUM_CLASS_FLAGS(EFruitPreviewDirty)
\ No newline at end of file
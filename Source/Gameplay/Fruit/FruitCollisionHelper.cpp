@@ -3,7 +3,8 @@
 #include "FruitMergeHelper.h"
 #include "Components/PrimitiveComponent.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
+#include "FruitPhysicsSchedulerSubsystem.h"
+#include "FruitRegistrySubsystem.h"
 
 void UFruitCollisionHelper::RegisterCollisionHandlers(AFruitBall* Fruit)
 {
@@ -45,6 +46,15 @@ void UFruitCollisionHelper::HandleBallHit(AFruitBall* Fruit, UPrimitiveComponent
 {
     if (!Fruit) return;
 
+    // 첫 충돌(던진 과일이 더미에 떨어진 순간)이면 충격 지점 근처의 잠든 과일 깨우기
+    if (!Fruit->HasCollidedBefore())
+    {
+        if (UFruitRegistrySubsystem* Registry = Fruit->GetWorld()->GetSubsystem<UFruitRegistrySubsystem>())
+        {
+            Registry->WakeFruitsInRadius(Hit.ImpactPoint, UFruitMergeHelper::GetContactWakeRadius(Fruit->GetBallType()));
+        }
+    }
+    
     // 충돌 경험 설정
     Fruit->SetHasCollided(true);
     
@@ -76,18 +86,10 @@ void UFruitCollisionHelper::StabilizeOnPlate(AFruitBall* Fruit, UPrimitiveCompon
     HitComponent->SetAngularDamping(10.0f);
     //HitComponent->SetLinearDamping(10.0f);
     
-    // 잠시 후에 완전히 안정화 - 약한 참조 사용
-    FTimerHandle StabilizeTimerHandle;
-    World->GetTimerManager().SetTimer(StabilizeTimerHandle, 
-        [WeakFruit=TWeakObjectPtr<AFruitBall>(Fruit), WeakMeshComp=TWeakObjectPtr<UPrimitiveComponent>(HitComponent)]() 
-        {
-            // 약한 포인터로 유효성 검사 (이미 소멸된 객체에 안전하게 접근)
-            if (WeakFruit.IsValid() && WeakMeshComp.IsValid() && WeakMeshComp->IsSimulatingPhysics())
-            {
-                // 일반 감쇠 값 복원
-                WeakMeshComp->SetAngularDamping(2.0f);
-                //WeakMeshComp->SetLinearDamping(2.0f);
-            }
-        }, 
-        1.0f, false);
+    // 잠시 후에 완전히 안정화 - 굴러가는 동안 계속 들어오는 접시 충돌은 같은 예약으로 합쳐짐
+    if (UFruitPhysicsSchedulerSubsystem* Scheduler = World->GetSubsystem<UFruitPhysicsSchedulerSubsystem>())
+    {
+        // 일반 감쇠 값 복원
+        Scheduler->Schedule(Fruit, EFruitScheduledAction::RestoreAngularDamping, 1.0f, 2.0f);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,271 @@
+#include "FruitMergeFeedbackSubsystem.h"
+#include "Actors/FruitBall.h"
+#include "System/Asset/FruitAssetSubsystem.h"
+#include "FruitTypeCatalog.h"
+#include "Components/AudioComponent.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Merge Feedback Played"), STAT_FruitFeedbackPlayed, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Merge Feedback Stolen"), STAT_FruitFeedbackStolen, STATGROUP_FruitMountain);
+
+static TAutoConsoleVariable<int32> CVarFruitFeedbackRingSize(
+    TEXT("Fruit.Feedback.RingSize"),
+    8,
+    TEXT("병합 이펙트/사운드 슬롯 수 (게임 시작 시 적용)"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFruitFeedbackStealFarthest(
+    TEXT("Fruit.Feedback.StealFarthest"),
+    0,
+    TEXT("링이 가득 찼을 때 0: 가장 오래된 슬롯을, 1: 카메라에서 가장 먼 슬롯을 재사용"),
+    ECVF_Default);
+
+// 이펙트 한 번이 끝나는 데 걸리는 시간 (이후 슬롯은 빈 것으로 간주)
+static constexpr double MergeEffectLifetime = 2.0;
+
+// 이펙트는 병합 지점보다 살짝 위에서 재생
+static const FVector MergeEffectOffset(0.0f, 0.0f, 10.0f);
+
+// 사용하지 않는 이펙트 보관 위치
+static const FVector MergeEffectParkingLocation(0.0f, 0.0f, -10000.0f);
+
+bool UFruitMergeFeedbackSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFruitMergeFeedbackSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // 에셋이 아직 로드 중이면 완료 후 슬롯 생성 (그 전 병합은 이펙트 없이 진행)
+    UFruitAssetSubsystem* Assets = UFruitAssetSubsystem::Get(&InWorld);
+    if (!Assets)
+    {
+        return;
+    }
+
+    if (Assets->AreAssetsReady())
+    {
+        HandleAssetsReady();
+    }
+    else
+    {
+        AssetsReadyHandle = Assets->OnAssetsReady.AddUObject(this, &UFruitMergeFeedbackSubsystem::HandleAssetsReady);
+    }
+}
+
+void UFruitMergeFeedbackSubsystem::HandleAssetsReady()
+{
+    UFruitAssetSubsystem* Assets = UFruitAssetSubsystem::Get(GetWorld());
+    if (!Assets)
+    {
+        return;
+    }
+
+    MergeEffectClass = Assets->GetMergeEffectClass();
+    MergeSound = Assets->GetMergeSound();
+
+    CreateEffectSlots(FMath::Max(1, CVarFruitFeedbackRingSize.GetValueOnGameThread()));
+}
+
+void UFruitMergeFeedbackSubsystem::Deinitialize()
+{
+    if (UFruitAssetSubsystem* Assets = UFruitAssetSubsystem::Get(GetWorld()))
+    {
+        Assets->OnAssetsReady.Remove(AssetsReadyHandle);
+    }
+
+    // 월드 정리 시 액터/컴포넌트도 함께 제거되므로 참조만 정리
+    EffectSlots.Empty();
+    AudioSlots.Empty();
+
+    Super::Deinitialize();
+}
+
+void UFruitMergeFeedbackSubsystem::CreateEffectSlots(int32 Count)
+{
+    UWorld* World = GetWorld();
+    if (!World || !MergeEffectClass)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MergeFeedback: 병합 이펙트 클래스를 찾을 수 없습니다."));
+        return;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    EffectSlots.Reserve(Count);
+    for (int32 i = 0; i < Count; i++)
+    {
+        AActor* EffectActor = World->SpawnActor<AActor>(MergeEffectClass, MergeEffectParkingLocation, FRotator::ZeroRotator, SpawnParams);
+        if (!EffectActor) break;
+
+        FFruitMergeEffectSlot& Slot = EffectSlots.AddDefaulted_GetRef();
+        Slot.EffectActor = EffectActor;
+
+        TArray<UFXSystemComponent*> Systems;
+        EffectActor->GetComponents(Systems);
+        for (UFXSystemComponent* System : Systems)
+        {
+            System->Deactivate();
+            Slot.Systems.Add(System);
+        }
+
+        EffectActor->SetActorHiddenInGame(true);
+    }
+}
+
+FVector UFruitMergeFeedbackSubsystem::GetListenerLocation() const
+{
+    APlayerController* PC = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+    if (PC && PC->PlayerCameraManager)
+    {
+        return PC->PlayerCameraManager->GetCameraLocation();
+    }
+    return FVector::ZeroVector;
+}
+
+int32 UFruitMergeFeedbackSubsystem::PickEffectSlot() const
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+    const bool bStealFarthest = CVarFruitFeedbackStealFarthest.GetValueOnGameThread() != 0;
+    const FVector ListenerLocation = bStealFarthest ? GetListenerLocation() : FVector::ZeroVector;
+
+    int32 BestIndex = INDEX_NONE;
+    double BestScore = -1.0;
+
+    for (int32 Index = 0; Index < EffectSlots.Num(); Index++)
+    {
+        const FFruitMergeEffectSlot& Slot = EffectSlots[Index];
+        if (!IsValid(Slot.EffectActor)) continue;
+
+        // 재생이 끝난 슬롯은 바로 사용
+        if (Slot.StartTime < 0.0 || Now - Slot.StartTime >= MergeEffectLifetime)
+        {
+            return Index;
+        }
+
+        const double Score = bStealFarthest
+            ? FVector::DistSquared(Slot.EffectActor->GetActorLocation(), ListenerLocation)
+            : Now - Slot.StartTime;
+        if (Score > BestScore)
+        {
+            BestScore = Score;
+            BestIndex = Index;
+        }
+    }
+
+    if (BestIndex != INDEX_NONE)
+    {
+        INC_DWORD_STAT(STAT_FruitFeedbackStolen);
+    }
+    return BestIndex;
+}
+
+int32 UFruitMergeFeedbackSubsystem::PickAudioSlot(bool bAllowSteal) const
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+    const bool bStealFarthest = CVarFruitFeedbackStealFarthest.GetValueOnGameThread() != 0;
+    const FVector ListenerLocation = bStealFarthest ? GetListenerLocation() : FVector::ZeroVector;
+
+    int32 BestIndex = INDEX_NONE;
+    double BestScore = -1.0;
+
+    for (int32 Index = 0; Index < AudioSlots.Num(); Index++)
+    {
+        const FFruitMergeAudioSlot& Slot = AudioSlots[Index];
+        if (!IsValid(Slot.AudioComponent)) continue;
+
+        if (!Slot.AudioComponent->IsPlaying())
+        {
+            return Index;
+        }
+
+        if (!bAllowSteal) continue;
+
+        const double Score = bStealFarthest
+            ? FVector::DistSquared(Slot.AudioComponent->GetComponentLocation(), ListenerLocation)
+            : Now - Slot.StartTime;
+        if (Score > BestScore)
+        {
+            BestScore = Score;
+            BestIndex = Index;
+        }
+    }
+
+    if (BestIndex != INDEX_NONE)
+    {
+        INC_DWORD_STAT(STAT_FruitFeedbackStolen);
+    }
+    return BestIndex;
+}
+
+void UFruitMergeFeedbackSubsystem::PlayMergeFeedback(const FVector& Location, int32 BallType)
+{
+    UWorld* World = GetWorld();
+    if (!World) return;
+
+    const FFruitTypeTableRow& Params = FFruitTypeTable::Get(BallType);
+    const double Now = World->GetTimeSeconds();
+
+    INC_DWORD_STAT(STAT_FruitFeedbackPlayed);
+
+    // 1. 시각적 효과 - 슬롯 액터를 옮기고 파티클을 처음부터 다시 재생
+    const int32 EffectIndex = PickEffectSlot();
+    if (EffectSlots.IsValidIndex(EffectIndex))
+    {
+        FFruitMergeEffectSlot& Slot = EffectSlots[EffectIndex];
+        Slot.EffectActor->SetActorLocation(Location + MergeEffectOffset, false, nullptr, ETeleportType::TeleportPhysics);
+        Slot.EffectActor->SetActorScale3D(FVector(Params.EffectScale));
+        Slot.EffectActor->SetActorHiddenInGame(false);
+
+        for (UFXSystemComponent* System : Slot.Systems)
+        {
+            if (System)
+            {
+                System->Activate(true);
+            }
+        }
+
+        Slot.StartTime = Now;
+    }
+
+    // 2. 소리 효과
+    if (!MergeSound) return;
+
+    // 링이 다 차기 전까지는 빈 슬롯이 없을 때 컴포넌트를 하나씩 만들고, 다 찬 뒤에는 빼앗아 재사용
+    const int32 RingSize = FMath::Max(1, CVarFruitFeedbackRingSize.GetValueOnGameThread());
+    const int32 AudioIndex = PickAudioSlot(AudioSlots.Num() >= RingSize);
+
+    if (AudioIndex == INDEX_NONE)
+    {
+        UAudioComponent* AudioComponent = UGameplayStatics::SpawnSoundAtLocation(
+            World, MergeSound, Location, FRotator::ZeroRotator,
+            Params.SoundVolume, Params.SoundPitch, 0.0f, nullptr, nullptr, false);
+        if (AudioComponent)
+        {
+            FFruitMergeAudioSlot& Slot = AudioSlots.AddDefaulted_GetRef();
+            Slot.AudioComponent = AudioComponent;
+            Slot.StartTime = Now;
+        }
+        return;
+    }
+
+    if (AudioSlots.IsValidIndex(AudioIndex))
+    {
+        FFruitMergeAudioSlot& Slot = AudioSlots[AudioIndex];
+        Slot.AudioComponent->Stop();
+        Slot.AudioComponent->SetWorldLocation(Location);
+        Slot.AudioComponent->SetVolumeMultiplier(Params.SoundVolume);
+        Slot.AudioComponent->SetPitchMultiplier(Params.SoundPitch);
+        Slot.AudioComponent->Play();
+        Slot.StartTime = Now;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FruitMergeFeedbackSubsystem.generated.h"
+
+class UAudioComponent;
+class UFXSystemComponent;
+class USoundBase;
+
+// 재사용하는 이펙트 슬롯
+USTRUCT()
+struct FFruitMergeEffectSlot
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<AActor> EffectActor = nullptr;
+
+    // 이펙트 액터의 파티클 컴포넌트 (재생 때마다 찾지 않도록 캐시)
+    UPROPERTY()
+    TArray<TObjectPtr<UFXSystemComponent>> Systems;
+
+    // 마지막 재생 시각 (-1이면 미사용)
+    double StartTime = -1.0;
+};
+
+// 재사용하는 사운드 슬롯
+USTRUCT()
+struct FFruitMergeAudioSlot
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UAudioComponent> AudioComponent = nullptr;
+
+    double StartTime = -1.0;
+};
+
+/**
+ * 병합 이펙트/사운드를 고정 크기 링으로 재사용하는 서브시스템
+ * 병합마다 이펙트 액터를 스폰하고 제거 타이머를 거는 대신 미리 만든 슬롯을 다시 재생
+ * 링이 가득 차면 가장 오래된(또는 가장 먼) 슬롯을 빼앗아 씀
+ * 타입별 이펙트 크기/볼륨/피치는 FFruitTypeTable에서 조회
+ */
+UCLASS()
+class UE_FRUITMOUNTAIN_API UFruitMergeFeedbackSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    // 병합 이펙트와 사운드 재생
+    void PlayMergeFeedback(const FVector& Location, int32 BallType);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // 에셋 로드 완료 후 이펙트/사운드 참조 받고 링 생성
+    void HandleAssetsReady();
+
+    // 이펙트 링 생성
+    void CreateEffectSlots(int32 Count);
+
+    // 재생할 슬롯 선택 (빈 슬롯 우선, 없으면 빼앗기)
+    int32 PickEffectSlot() const;
+    int32 PickAudioSlot(bool bAllowSteal) const;
+
+    // 슬롯을 빼앗을 때 기준 위치 (플레이어 카메라)
+    FVector GetListenerLocation() const;
+
+    UPROPERTY()
+    TArray<FFruitMergeEffectSlot> EffectSlots;
+
+    UPROPERTY()
+    TArray<FFruitMergeAudioSlot> AudioSlots;
+
+    UPROPERTY()
+    TSubclassOf<AActor> MergeEffectClass;
+
+    UPROPERTY()
+    TObjectPtr<USoundBase> MergeSound = nullptr;
+
+    FDelegateHandle AssetsReadyHandle;
+};
\ No newline at end of file
@@ -6,6 +6,34 @@
 #include "Framework/UE_FruitMountainGameMode.h"
 #include "Components/StaticMeshComponent.h"
 #include "Gameplay/Fruit/ScoreManagerComponent.h"
+#include "Gameplay/Fruit/FruitRegistrySubsystem.h"
+#include "Gameplay/Fruit/FruitMergeQueueSubsystem.h"
+#include "Gameplay/Fruit/FruitMergeFeedbackSubsystem.h"
+#include "System/Asset/FruitAssetSubsystem.h"
+#include "Gameplay/Fruit/FruitTypeCatalog.h"
+#include "Gameplay/Fruit/FruitPhysicsSchedulerSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Stabilize Fruits"), STAT_FruitStabilize, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Stabilized Fruits"), STAT_FruitStabilizedCount, STATGROUP_FruitMountain);
+
+// 병합당 액터 생성/제거 수 (누적) - (Spawns + Destroys) / Merges 가 병합당 액터 변동량
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Merge Total Merges"), STAT_FruitMergeTotalMerges, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Merge Total Spawns"), STAT_FruitMergeTotalSpawns, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Merge Total Destroys"), STAT_FruitMergeTotalDestroys, STATGROUP_FruitMountain);
+
+// 제자리 병합: 1이면 FruitA를 승격하고 FruitB만 제거 (생성 0, 제거 1), 0이면 두 과일 제거 후 새로 생성 (생성 1, 제거 2)
+static TAutoConsoleVariable<int32> CVarFruitMergeInPlace(
+    TEXT("Fruit.Merge.InPlace"),
+    1,
+    TEXT("1: 병합 시 기존 과일을 다음 레벨로 승격, 0: 두 과일 제거 후 새 과일 생성"),
+    ECVF_Default);
+
+bool UFruitMergeHelper::IsInPlaceMergeEnabled()
+{
+    return CVarFruitMergeInPlace.GetValueOnGameThread() != 0;
+}
 
 void UFruitMergeHelper::TryMergeFruits(AFruitBall* FruitA, AFruitBall* FruitB, const FVector& CollisionPoint)
 {
@@ -35,12 +63,16 @@ void UFruitMergeHelper::TryMergeFruits(AFruitBall* FruitA, AFruitBall* FruitB, c
         return;
     }
     
-    // 두 과일 모두 병합 상태로 설정
-    FruitA->SetMerging(true);
-    FruitB->SetMerging(true);
+    // 충돌 콜백 안에서는 병합하지 않고 큐에 등록 (물리 이후 한 번에 처리)
+    UWorld* World = FruitA->GetWorld();
+    UFruitMergeQueueSubsystem* MergeQueue = World ? World->GetSubsystem<UFruitMergeQueueSubsystem>() : nullptr;
+    if (!MergeQueue)
+    {
+        UE_LOG(LogTemp, Error, TEXT("TryMergeFruits: 병합 큐를 찾을 수 없음"));
+        return;
+    }
     
-    // 병합 처리 수행
-    MergeFruits(FruitA, FruitB, CollisionPoint);
+    MergeQueue->EnqueueMerge(FruitA, FruitB, CollisionPoint);
 }
 
 void UFruitMergeHelper::MergeFruits(AFruitBall* FruitA, AFruitBall* FruitB, const FVector& MergeLocation)
@@ -50,12 +82,42 @@ void UFruitMergeHelper::MergeFruits(AFruitBall* FruitA, AFruitBall* FruitB, cons
         return;
     }
     
+    // 큐를 거치지 않는 즉시 병합 - 큐와 같은 단계를 순서대로 수행
+    FFruitMergeOutcome Outcome;
+    if (ResolveMerge(FruitA, FruitB, MergeLocation, Outcome))
+    {
+        ApplyMergeOutcome(FruitA->GetWorld(), Outcome);
+    }
+    
+    // 기존 과일들 제거 (승격된 과일은 유지)
+    if (Outcome.KeptFruit != FruitA)
+    {
+        RetireMergedFruit(FruitA);
+    }
+    RetireMergedFruit(FruitB);
+}
+
+bool UFruitMergeHelper::ResolveMerge(AFruitBall* FruitA, AFruitBall* FruitB, const FVector& MergeLocation, FFruitMergeOutcome& OutOutcome)
+{
+    if (!FruitA || !FruitB) {
+        UE_LOG(LogTemp, Error, TEXT("ResolveMerge: 과일 참조가 유효하지 않음"));
+        return false;
+    }
+    
     // 두 과일의 타입 가져오기
     int32 TypeA = FruitA->GetBallType();
-    int32 TypeB = FruitB->GetBallType();
     
     UWorld* World = FruitA->GetWorld();
-    if (!World) return;
+    if (!World) return false;
+    
+    INC_DWORD_STAT(STAT_FruitMergeTotalMerges);
+    
+    // 두 과일이 빠지거나 커지면서 맞닿은 과일이 움직여야 하므로 접촉 범위만 깨움
+    if (UFruitRegistrySubsystem* Registry = World->GetSubsystem<UFruitRegistrySubsystem>())
+    {
+        const int32 WakeType = FMath::Min(TypeA + 1, int32(AFruitBall::MaxBallType));
+        Registry->WakeFruitsInRadius(MergeLocation, GetContactWakeRadius(WakeType));
+    }
     
     // 마지막 레벨 체크
     if (TypeA >= AFruitBall::MaxBallType)
@@ -63,10 +125,7 @@ void UFruitMergeHelper::MergeFruits(AFruitBall* FruitA, AFruitBall* FruitB, cons
         UE_LOG(LogTemp, Warning, TEXT("병합 완료: 최대 레벨 과일 병합"));
         AddScore(World, TypeA); // World 인자 추가
         PlayMergeEffect(World, MergeLocation, TypeA);
-        
-        FruitA->Destroy();
-        FruitB->Destroy();
-        return;
+        return false;
     }
     
     // 다음 레벨의 과일 생성
@@ -77,61 +136,131 @@ void UFruitMergeHelper::MergeFruits(AFruitBall* FruitA, AFruitBall* FruitB, cons
     AddScore(World, NextType); // World 인자 추가
     
     // 병합 위치 주변 과일들의 속도 감소 (폭발적 충돌 방지)
-    StabilizeFruits(World);
+    StabilizeFruits(World, MergeLocation, AFruitBall::CalculateBallSize(NextType) * StabilizeRadiusScale);
+    
+    // 새 과일 생성 정보 - 기존 과일의 회전값 유지
+    OutOutcome.NextType = NextType;
+    OutOutcome.Location = MergeLocation;
+    OutOutcome.Rotation = FruitA->GetActorRotation();
+    OutOutcome.KeptFruit = IsInPlaceMergeEnabled() ? FruitA : nullptr;
+    return true;
+}
+
+AFruitBall* UFruitMergeHelper::ApplyMergeOutcome(UWorld* World, const FFruitMergeOutcome& Outcome)
+{
+    if (IsValid(Outcome.KeptFruit))
+    {
+        PromoteFruit(Outcome.KeptFruit, Outcome);
+        return Outcome.KeptFruit;
+    }
     
-    // 새 과일 생성 전에 기존 과일의 회전값 저장
-    FRotator ExistingRotation = FruitA->GetActorRotation();
+    return SpawnMergedFruit(World, Outcome);
+}
+
+void UFruitMergeHelper::RetireMergedFruit(AFruitBall* Fruit)
+{
+    if (!IsValid(Fruit)) return;
+    
+    // 액터를 제거하지 않고 풀에 반납
+    INC_DWORD_STAT(STAT_FruitMergeTotalDestroys);
+    UFruitSpawnHelper::ReleaseBall(Fruit);
+}
+
+void UFruitMergeHelper::PromoteFruit(AFruitBall* Fruit, const FFruitMergeOutcome& Outcome)
+{
+    if (!Fruit || !Fruit->GetMeshComponent()) return;
+    
+    UStaticMeshComponent* MeshComp = Fruit->GetMeshComponent();
+    
+    // 1. 타입 변경 (메시 교체 포함)
+    Fruit->SetBallType(Outcome.NextType);
+    
+    // 2. 크기 및 질량 갱신
+    Fruit->SetActorScale3D(FVector(UFruitSpawnHelper::CalculateBallSize(Outcome.NextType)));
+    MeshComp->SetMassOverrideInKg(NAME_None, AFruitBall::CalculateBallMass(Outcome.NextType));
+    
+    // 3. 병합 지점으로 순간이동 (물리 상태도 함께 이동)
+    Fruit->SetActorLocationAndRotation(Outcome.Location, Outcome.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+    MeshComp->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+    
+    // 4. 새 과일과 같은 물리 속성 적용 후 병합 상태 해제
+    StabilizeFruitPhysics(Fruit, 8.0f, true);
+    Fruit->SetMerging(false);
+    
+    UE_LOG(LogTemp, Warning, TEXT("과일 승격 완료: 레벨=%d, 위치=%s"), 
+           Outcome.NextType, *Outcome.Location.ToString());
+}
+
+AFruitBall* UFruitMergeHelper::SpawnMergedFruit(UWorld* World, const FFruitMergeOutcome& Outcome)
+{
+    if (!World) return nullptr;
     
-    // 새 과일 생성
     AFruitPlayerController* Controller = Cast<AFruitPlayerController>(UGameplayStatics::GetPlayerController(World, 0));
-    if (Controller)
+    if (!Controller) return nullptr;
+    
+    // 정확히 병합 위치에 생성
+    AActor* SpawnedActor = UFruitSpawnHelper::SpawnBall(Controller, Outcome.Location, Outcome.NextType, true);
+    AFruitBall* NewFruit = Cast<AFruitBall>(SpawnedActor);
+    
+    if (SpawnedActor)
     {
-        // 정확히 병합 위치에 생성
-        AActor* SpawnedActor = UFruitSpawnHelper::SpawnBall(Controller, MergeLocation, NextType, true);
-        AFruitBall* NewFruit = Cast<AFruitBall>(SpawnedActor);
-        
-        // 생성된 과일에 자연스러운 움직임 적용
-        if (NewFruit && NewFruit->GetMeshComponent())
-        {
-            // 기존 과일의 회전각 적용
-            NewFruit->SetActorRotation(ExistingRotation);
-            
-            // 새 과일 물리 속성 설정
-            StabilizeFruitPhysics(NewFruit, 8.0f, true);
-        }
+        INC_DWORD_STAT(STAT_FruitMergeTotalSpawns);
+    }
+    
+    // 생성된 과일에 자연스러운 움직임 적용
+    if (NewFruit && NewFruit->GetMeshComponent())
+    {
+        // 기존 과일의 회전각 적용
+        NewFruit->SetActorRotation(Outcome.Rotation);
         
-        UE_LOG(LogTemp, Warning, TEXT("새 과일 생성 완료: 레벨=%d, 위치=%s"), 
-               NextType, *MergeLocation.ToString());
+        // 새 과일 물리 속성 설정
+        StabilizeFruitPhysics(NewFruit, 8.0f, true);
     }
     
-    // 기존 과일들 제거
-    FruitA->Destroy();
-    FruitB->Destroy();
+    UE_LOG(LogTemp, Warning, TEXT("새 과일 생성 완료: 레벨=%d, 위치=%s"), 
+           Outcome.NextType, *Outcome.Location.ToString());
+    
+    return NewFruit;
 }
 
-// 모든 과일 안정화 함수
-void UFruitMergeHelper::StabilizeFruits(UWorld* World)
+// 병합 지점 주변 과일 안정화 함수
+void UFruitMergeHelper::StabilizeFruits(UWorld* World, const FVector& MergeLocation, float ImpulseRadius)
 {
     if (!World) return;
     
-    // 현재 월드의 모든 과일 찾기
-    TArray<AActor*> FoundFruits;
-    UGameplayStatics::GetAllActorsOfClass(World, AFruitBall::StaticClass(), FoundFruits);
+    SCOPE_CYCLE_COUNTER(STAT_FruitStabilize);
+    
+    UFruitRegistrySubsystem* Registry = World->GetSubsystem<UFruitRegistrySubsystem>();
+    if (!Registry) return;
+    
+    // 레지스트리 공간 해시로 병합 지점 반경 안의 과일만 찾기
+    TArray<AFruitBall*> NearbyFruits;
+    Registry->GetFruitsInRadius(MergeLocation, ImpulseRadius, NearbyFruits);
+    
+    INC_DWORD_STAT_BY(STAT_FruitStabilizedCount, NearbyFruits.Num());
     
-    // 모든 과일에 감속 적용
-    for (AActor* Actor : FoundFruits)
+    // 주변 과일에만 감속 적용
+    for (AFruitBall* Fruit : NearbyFruits)
     {
-        AFruitBall* Fruit = Cast<AFruitBall>(Actor);
-        if (!Fruit || !Fruit->GetMeshComponent()) continue;
+        if (!Fruit->GetMeshComponent()) continue;
         
         // 미리보기 공이나 이미 병합 중인 과일 제외
         if (Fruit->IsPreviewBall() || Fruit->IsMerging()) continue;
         
+        // 잠든 과일은 건드리지 않음 (속도/감쇠를 쓰면 깨어나 더미 전체가 다시 계산됨)
+        if (!Fruit->GetMeshComponent()->RigidBodyIsAwake()) continue;
+        
         // 기존 과일 물리 속성 안정화
         StabilizeFruitPhysics(Fruit, 20.0f, false);
     }
 }
 
+float UFruitMergeHelper::GetContactWakeRadius(int32 BallType)
+{
+    // 중심 거리가 (이 과일 반지름 + 가장 큰 과일 반지름) 이내면 맞닿아 있을 수 있음
+    return (AFruitBall::CalculateBallSize(BallType) + AFruitBall::CalculateBallSize(AFruitBall::MaxBallType)) * 0.5f * ContactWakeMargin;
+}
+
 // 과일 물리 속성 설정을 위한 통합 헬퍼 함수
 void UFruitMergeHelper::StabilizeFruitPhysics(AFruitBall* Fruit, float InitialDampingMultiplier, bool bIsNewFruit)
 {
@@ -141,9 +270,13 @@ void UFruitMergeHelper::StabilizeFruitPhysics(AFruitBall* Fruit, float InitialDa
     UWorld* World = Fruit->GetWorld();
     if (!World) return;
     
-    // 1. 크기 인자 계산
-    int32 FruitType = Fruit->GetBallType();
-    float SizeFactor = FMath::Min(2.0f, 0.5f + (FruitType * 0.2f));
+    // 1. 크기 인자 (타입 테이블)
+    const int32 FruitType = Fruit->GetBallType();
+    const FFruitTypeTableRow& TypeRow = FFruitTypeTable::Get(FruitType);
+    const float SizeFactor = TypeRow.SizeFactor;
+    const float SettledDamping = TypeRow.SettledDamping;
+    
+    UFruitPhysicsSchedulerSubsystem* Scheduler = World->GetSubsystem<UFruitPhysicsSchedulerSubsystem>();
     
     // 2. 현재 위치 기반 중앙 방향 힘 계산
     FVector ToCenterXY = FVector::ZeroVector - Fruit->GetActorLocation();
@@ -173,16 +306,10 @@ void UFruitMergeHelper::StabilizeFruitPhysics(AFruitBall* Fruit, float InitialDa
         MeshComp->SetPhysicsLinearVelocity(FinalVelocity);
         
         // 0.1초 후 충돌 재활성화
-        FTimerHandle CollisionHandle;
-        World->GetTimerManager().SetTimer(CollisionHandle, 
-            [WeakMesh=TWeakObjectPtr<UPrimitiveComponent>(MeshComp)]() 
-            {
-                if (WeakMesh.IsValid())
-                {
-                    WeakMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-                }
-            }, 
-            0.1f, false);
+        if (Scheduler)
+        {
+            Scheduler->Schedule(Fruit, EFruitScheduledAction::EnableCollision, 0.1f);
+        }
     }
     else
     {
@@ -207,19 +334,11 @@ void UFruitMergeHelper::StabilizeFruitPhysics(AFruitBall* Fruit, float InitialDa
     MeshComp->SetLinearDamping(InitialDampingMultiplier * SizeFactor);
     MeshComp->SetAngularDamping(InitialDampingMultiplier * SizeFactor);
     
-    // 5. 감쇠 복원 타이머
-    FTimerHandle DampingTimerHandle;
-    World->GetTimerManager().SetTimer(DampingTimerHandle, 
-        [WeakFruit=TWeakObjectPtr<AFruitBall>(Fruit), SizeFactor]() 
-        {
-            if (WeakFruit.IsValid() && WeakFruit->GetMeshComponent())
-            {
-                UStaticMeshComponent* MeshComp = WeakFruit->GetMeshComponent();
-                MeshComp->SetLinearDamping(2.0f * SizeFactor);
-                MeshComp->SetAngularDamping(2.0f * SizeFactor);
-            }
-        }, 
-        0.5f, false);
+    // 5. 감쇠 복원 예약 (다시 안정화되면 기존 예약의 시각만 갱신)
+    if (Scheduler)
+    {
+        Scheduler->Schedule(Fruit, EFruitScheduledAction::RestoreDamping, 0.5f, SettledDamping);
+    }
 }
 
 
@@ -270,110 +389,20 @@ void UFruitMergeHelper::PlayMergeEffect(UWorld* World, const FVector& Location,
 {
     if (!World) return;
     
-    // 1. 시각적 효과 (블루프린트 액터)
-    static TSubclassOf<AActor> MergeEffectClass = nullptr;
-    if (!MergeEffectClass)
-    {
-        // 블루프린트 액터 클래스 로드
-        MergeEffectClass = LoadClass<AActor>(nullptr, TEXT("/Game/Particle/02_Blueprints/BP_Particle_Burst_Lvl_1.BP_Particle_Burst_Lvl_1_C"));
-    }
-    
-    if (MergeEffectClass)
+    // 이펙트/사운드는 피드백 링에서 재사용 (병합마다 액터 스폰, 타이머 없음)
+    if (UFruitMergeFeedbackSubsystem* Feedback = World->GetSubsystem<UFruitMergeFeedbackSubsystem>())
     {
-        // 블루프린트 액터 생성 (Z축으로 100 올림)
-        FVector ElevatedLocation = Location + FVector(0, 0, 10.0f);
-        
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-        
-        // 크기를 과일 레벨에 따라 조정
-        float EffectScale = 1.0f;
-        AActor* MergeEffect = World->SpawnActor<AActor>(
-            MergeEffectClass, 
-            ElevatedLocation,
-            FRotator::ZeroRotator, 
-            SpawnParams
-        );
-        
-        if (MergeEffect)
-        {
-            MergeEffect->SetActorScale3D(FVector(EffectScale));
-            
-            // 2초 후에 효과 제거
-            FTimerHandle DestroyTimerHandle;
-            World->GetTimerManager().SetTimer(
-                DestroyTimerHandle,
-                FTimerDelegate::CreateLambda([MergeEffect]() {
-                    if (IsValid(MergeEffect))
-                    {
-                        MergeEffect->Destroy();
-                    }
-                }),
-                2.0f,
-                false
-            );
-        }
-    }
-    
-    // 2. 소리 효과
-    static USoundBase* MergeSound = nullptr;
-    if (!MergeSound)
-    {
-        // 사운드 에셋 로드 (게임에 맞는 경로로 수정 필요)
-        MergeSound = LoadObject<USoundBase>(nullptr, TEXT("/Game/Sounds/S_FruitMerge"));
-    }
-    
-    if (MergeSound)
-    {
-        UGameplayStatics::PlaySoundAtLocation(
-            World, MergeSound, Location, 
-            1.0f + (BallType * 0.1f),  // 볼륨 (레벨이 높을수록 더 큰 소리)
-            0.8f + (BallType * 0.05f)  // 피치 (레벨이 높을수록 더 높은 소리)
-        );
+        Feedback->PlayMergeFeedback(Location, BallType);
     }
 }
 
 void UFruitMergeHelper::PreloadAllFruitMeshes(UWorld* World)
 {
-    UE_LOG(LogTemp, Display, TEXT("게임 에셋 사전 로드 시작..."));
-    
-    // 1. 모든 과일 메시 미리 로드 (최대 레벨까지)
-    for (int32 i = 1; i <= AFruitBall::MaxBallType; i++)
+    // 메시, 파티클, 사운드는 UFruitAssetSubsystem이 비동기로 스트리밍 (게임 스레드 블로킹 없음)
+    // 게임 인스턴스 초기화 때 이미 시작되므로 여기서는 시작 여부만 보장
+    if (UFruitAssetSubsystem* Assets = UFruitAssetSubsystem::Get(World))
     {
-        // 메시 경로 - 게임의 실제 경로와 일치하게 수정
-        FString MeshPath = FString::Printf(TEXT("/Game/Fruit/Meshes/Fruit%d.Fruit%d"), i, i);
-        
-        // 동기적 로딩 사용
-        UStaticMesh* FruitMesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
-        
-        if (FruitMesh)
-        {
-            // 메시가 완전히 로드되도록 보장
-            FruitMesh->ConditionalPostLoad();
-        }
-    }
-    
-    // 2. 파티클 효과 미리 로드
-    TSubclassOf<AActor> PreloadParticleClass = LoadClass<AActor>(nullptr, TEXT("/Game/Particle/02_Blueprints/BP_Particle_Burst_Lvl_1.BP_Particle_Burst_Lvl_1_C"));
-    if (PreloadParticleClass && World)
-    {
-        FVector HiddenLocation = FVector(0, 0, -10000);
-        AActor* PreloadActor = World->SpawnActor<AActor>(PreloadParticleClass, HiddenLocation, FRotator::ZeroRotator);
-        if (PreloadActor)
-        {
-            PreloadActor->SetActorHiddenInGame(true);
-            PreloadActor->SetActorTickEnabled(false);
-            
-            FTimerHandle DestroyHandle;
-            World->GetTimerManager().SetTimer(DestroyHandle, [PreloadActor]() {
-                if(IsValid(PreloadActor)) PreloadActor->Destroy();
-            }, 0.1f, false);
-        }
-        
+        Assets->StartAsyncLoad();
+        UE_LOG(LogTemp, Display, TEXT("게임 에셋 비동기 로드 %s"), Assets->AreAssetsReady() ? TEXT("완료") : TEXT("진행 중"));
     }
-    
-    // 3. 사운드도 미리 로드
-    USoundBase* PreloadSound = LoadObject<USoundBase>(nullptr, TEXT("/Game/Sounds/S_FruitMerge"));
-
-    UE_LOG(LogTemp, Display, TEXT("메시 및 사운드 사전 로드 완료"));
 }
\ No newline at end of file
@@ -9,18 +9,48 @@ class UScoreManagerComponent;
 class AFruitBall;
 class UWorld;
 
+// 병합 결과 - 다음 레벨 과일 정보
+struct FFruitMergeOutcome
+{
+    int32 NextType = 1;
+    FVector Location = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    
+    // 제자리 병합 시 승격시킬 과일 (nullptr이면 새 과일 생성)
+    AFruitBall* KeptFruit = nullptr;
+};
+
 UCLASS()
 class UE_FRUITMOUNTAIN_API UFruitMergeHelper : public UBlueprintFunctionLibrary
 {
     GENERATED_BODY()
     
 public:
-    // 과일 병합 시도 (새로 추가)
+    // 과일 병합 시도 - 조건이 맞으면 병합 큐에 등록 (실제 병합은 물리 이후 처리)
     static void TryMergeFruits(AFruitBall* FruitA, AFruitBall* FruitB, const FVector& CollisionPoint);
     
-    // 과일 병합 수행
+    // 과일 병합 즉시 수행 (큐를 거치지 않음)
     static void MergeFruits(AFruitBall* FruitA, AFruitBall* FruitB, const FVector& MergeLocation);
     
+    // 병합 1단계: 점수, 이펙트, 주변 안정화 처리 - 다음 레벨 과일이 필요하면 true와 결과 정보 반환
+    // 제자리 병합 모드면 OutOutcome.KeptFruit에 FruitA가 들어가며 FruitA는 제거하지 않아야 함
+    static bool ResolveMerge(AFruitBall* FruitA, AFruitBall* FruitB, const FVector& MergeLocation, FFruitMergeOutcome& OutOutcome);
+    
+    // 병합 2단계: 남길 과일을 승격하거나 다음 레벨 과일 생성
+    static AFruitBall* ApplyMergeOutcome(UWorld* World, const FFruitMergeOutcome& Outcome);
+    
+    // 병합 3단계: 병합에 사용된 과일 제거
+    static void RetireMergedFruit(AFruitBall* Fruit);
+    
+    // 기존 과일을 다음 레벨로 승격 (타입, 크기, 질량 변경 후 병합 지점으로 순간이동)
+    static void PromoteFruit(AFruitBall* Fruit, const FFruitMergeOutcome& Outcome);
+    
+    // 다음 레벨 과일 생성
+    static AFruitBall* SpawnMergedFruit(UWorld* World, const FFruitMergeOutcome& Outcome);
+    
+    // 제자리 병합 모드 여부 (Fruit.Merge.InPlace)
+    static bool IsInPlaceMergeEnabled();
+    
     // 점수 추가
     UFUNCTION(BlueprintCallable, Category = "Score")
     static void AddScore(UWorld* World, int32 BallType);
@@ -28,8 +58,20 @@ public:
     // 병합 이펙트 재생
     static void PlayMergeEffect(UWorld* World, const FVector& Location, int32 BallType);
     
+    // 병합 지점 주변 과일들을 안정화 (ImpulseRadius 안의 과일만 처리)
+    static void StabilizeFruits(UWorld* World, const FVector& MergeLocation, float ImpulseRadius);
+    
     // 병합 시 과일들을 안정화하는 함수
-    static void StabilizeFruitPhysicscs(AFruitBall* Fruit, float InitialDampingMultiplier, bool bIsNewFruit);
+    static void StabilizeFruitPhysics(AFruitBall* Fruit, float InitialDampingMultiplier, bool bIsNewFruit);
+    
+    // 안정화 반경 = 새 과일 크기 * 배율
+    static constexpr float StabilizeRadiusScale = 3.0f;
+    
+    // BallType 과일과 맞닿아 있을 수 있는 과일을 찾는 반경 (잠든 과일 깨우기용)
+    static float GetContactWakeRadius(int32 BallType);
+    
+    // 접촉 반경 여유 배율
+    static constexpr float ContactWakeMargin = 1.1f;
     
     // 연쇄 초기화 함수
     UFUNCTION(BlueprintCallable, Category = "Score")
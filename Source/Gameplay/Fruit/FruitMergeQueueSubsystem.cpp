@@ -0,0 +1,172 @@
+#include "FruitMergeQueueSubsystem.h"
+#include "FruitMergeHelper.h"
+#include "Actors/FruitBall.h"
+#include "Engine/World.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Merge Queue Drain"), STAT_FruitMergeQueueDrain, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Merge Requests"), STAT_FruitMergeRequests, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Merges Resolved"), STAT_FruitMergesResolved, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Merge Conflicts Dropped"), STAT_FruitMergeConflicts, STATGROUP_FruitMountain);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Actor Churn Per Merge"), STAT_FruitMergeChurnPerMerge, STATGROUP_FruitMountain);
+
+bool UFruitMergeQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFruitMergeQueueSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // 물리 결과(충돌 콜백)가 모두 들어온 뒤 한 번에 처리
+    MergeTickFunction.Setup(&InWorld, TG_PostPhysics,
+        [this](float DeltaTime)
+        {
+            ProcessPendingMerges();
+        },
+        TEXT("FruitMergeQueue"));
+}
+
+void UFruitMergeQueueSubsystem::Deinitialize()
+{
+    MergeTickFunction.Teardown();
+
+    PendingRequests.Empty();
+    PendingPairKeys.Empty();
+
+    Super::Deinitialize();
+}
+
+void UFruitMergeQueueSubsystem::EnqueueMerge(AFruitBall* FruitA, AFruitBall* FruitB, const FVector& Location)
+{
+    if (!FruitA || !FruitB || FruitA == FruitB)
+    {
+        return;
+    }
+
+    // 두 과일 양쪽에서 같은 충돌이 보고되므로 순서와 무관한 키로 중복 제거
+    if (FruitA->GetUniqueID() > FruitB->GetUniqueID())
+    {
+        Swap(FruitA, FruitB);
+    }
+
+    const uint64 PairKey = (uint64(FruitA->GetUniqueID()) << 32) | uint64(FruitB->GetUniqueID());
+
+    bool bAlreadyQueued = false;
+    PendingPairKeys.Add(PairKey, &bAlreadyQueued);
+    if (bAlreadyQueued)
+    {
+        return;
+    }
+
+    FFruitMergeRequest& Request = PendingRequests.AddDefaulted_GetRef();
+    Request.FruitA = FruitA;
+    Request.FruitB = FruitB;
+    Request.Location = Location;
+    Request.PairKey = PairKey;
+
+    INC_DWORD_STAT(STAT_FruitMergeRequests);
+}
+
+void UFruitMergeQueueSubsystem::ProcessPendingMerges()
+{
+    if (PendingRequests.Num() == 0)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_FruitMergeQueueDrain);
+
+    UWorld* World = GetWorld();
+
+    // 1. 콜백 도착 순서와 무관하게 결정적인 순서로 정렬
+    PendingRequests.Sort([](const FFruitMergeRequest& A, const FFruitMergeRequest& B)
+    {
+        return A.PairKey < B.PairKey;
+    });
+
+    // 2. 충돌 해결 - 한 과일은 프레임당 한 쌍에만 참여 (먼저 정렬된 쌍 우선)
+    AcceptedRequests.Reset();
+    ClaimedFruits.Reset();
+
+    for (const FFruitMergeRequest& Request : PendingRequests)
+    {
+        AFruitBall* FruitA = Request.FruitA.Get();
+        AFruitBall* FruitB = Request.FruitB.Get();
+
+        // 요청 이후 제거되었거나 상태가 바뀐 과일은 무시
+        if (!IsValid(FruitA) || !IsValid(FruitB)) continue;
+        if (FruitA->IsMerging() || FruitB->IsMerging()) continue;
+        if (FruitA->GetBallType() != FruitB->GetBallType()) continue;
+
+        if (ClaimedFruits.Contains(FruitA) || ClaimedFruits.Contains(FruitB))
+        {
+            INC_DWORD_STAT(STAT_FruitMergeConflicts);
+            continue;
+        }
+
+        ClaimedFruits.Add(FruitA);
+        ClaimedFruits.Add(FruitB);
+
+        FruitA->SetMerging(true);
+        FruitB->SetMerging(true);
+
+        AcceptedRequests.Add(Request);
+    }
+
+    PendingRequests.Reset();
+    PendingPairKeys.Reset();
+
+    // 3. 점수, 이펙트, 주변 안정화 처리 후 승격/생성할 과일 정보 수집
+    TArray<FFruitMergeOutcome, TInlineAllocator<16>> Outcomes;
+    RetiredFruits.Reset();
+
+    for (const FFruitMergeRequest& Request : AcceptedRequests)
+    {
+        AFruitBall* FruitA = Request.FruitA.Get();
+        AFruitBall* FruitB = Request.FruitB.Get();
+
+        FFruitMergeOutcome Outcome;
+        if (UFruitMergeHelper::ResolveMerge(FruitA, FruitB, Request.Location, Outcome))
+        {
+            Outcomes.Add(Outcome);
+        }
+
+        // 제자리 병합이면 FruitA는 승격되므로 FruitB만 제거
+        if (Outcome.KeptFruit != FruitA)
+        {
+            RetiredFruits.Add(FruitA);
+        }
+        RetiredFruits.Add(FruitB);
+    }
+
+    // 4. 승격 및 생성 일괄 처리
+    int32 SpawnCount = 0;
+    for (const FFruitMergeOutcome& Outcome : Outcomes)
+    {
+        if (!Outcome.KeptFruit)
+        {
+            SpawnCount++;
+        }
+        UFruitMergeHelper::ApplyMergeOutcome(World, Outcome);
+    }
+
+    // 5. 제거 일괄 처리
+    for (AFruitBall* Fruit : RetiredFruits)
+    {
+        UFruitMergeHelper::RetireMergedFruit(Fruit);
+    }
+
+    INC_DWORD_STAT_BY(STAT_FruitMergesResolved, AcceptedRequests.Num());
+
+    // 병합당 액터 생성+제거 수 (기존 방식 3, 제자리 병합 1)
+    if (AcceptedRequests.Num() > 0)
+    {
+        SET_FLOAT_STAT(STAT_FruitMergeChurnPerMerge, float(SpawnCount + RetiredFruits.Num()) / AcceptedRequests.Num());
+    }
+
+    AcceptedRequests.Reset();
+    ClaimedFruits.Reset();
+    RetiredFruits.Reset();
+}
\ No newline at end of file
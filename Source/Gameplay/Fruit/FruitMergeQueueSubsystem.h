@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "System/Tick/FruitTickFunction.h"
+#include "FruitMergeQueueSubsystem.generated.h"
+
+class AFruitBall;
+
+// 충돌 콜백에서 쌓아두는 병합 요청
+struct FFruitMergeRequest
+{
+    TWeakObjectPtr<AFruitBall> FruitA;
+    TWeakObjectPtr<AFruitBall> FruitB;
+    FVector Location = FVector::ZeroVector;
+
+    // 두 과일 UniqueID로 만든 쌍 키 (작은 ID가 상위 32비트)
+    uint64 PairKey = 0;
+};
+
+/**
+ * 병합 요청을 모아 물리 이후(TG_PostPhysics)에 프레임당 한 번 처리하는 큐
+ * Chaos 충돌 콜백 안에서 생성/제거/물리 상태 변경을 하지 않도록 병합을 지연시킴
+ */
+UCLASS()
+class UE_FRUITMOUNTAIN_API UFruitMergeQueueSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    // 병합 요청 추가 (같은 쌍은 프레임당 한 번만 등록)
+    void EnqueueMerge(AFruitBall* FruitA, AFruitBall* FruitB, const FVector& Location);
+
+    // 대기 중인 병합을 모두 처리
+    void ProcessPendingMerges();
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // TG_PostPhysics 틱
+    FFruitTickFunction MergeTickFunction;
+
+    // 이번 프레임에 쌓인 요청
+    TArray<FFruitMergeRequest> PendingRequests;
+
+    // 중복 쌍 검사용 키
+    TSet<uint64> PendingPairKeys;
+
+    // 처리 중 재사용하는 버퍼 (프레임마다 할당하지 않도록 유지)
+    TArray<FFruitMergeRequest> AcceptedRequests;
+    TSet<AFruitBall*> ClaimedFruits;
+    TArray<AFruitBall*> RetiredFruits;
+};
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "FruitMeshComponent.h"
+#include "Engine/World.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fruit Body Creations"), STAT_FruitBodyCreations, STATGROUP_FruitMountain);
+
+uint32 UFruitMeshComponent::TotalBodyCreations = 0;
+
+void UFruitMeshComponent::DeferPhysicsState()
+{
+    bPhysicsStateDeferred = true;
+
+    if (IsPhysicsStateCreated())
+    {
+        DestroyPhysicsState();
+    }
+}
+
+void UFruitMeshComponent::FinishPhysicsState()
+{
+    if (!bPhysicsStateDeferred)
+    {
+        return;
+    }
+    bPhysicsStateDeferred = false;
+
+    if (IsRegistered() && !IsPhysicsStateCreated() && ShouldCreatePhysicsState())
+    {
+        CreatePhysicsState();
+    }
+}
+
+bool UFruitMeshComponent::ShouldCreatePhysicsState() const
+{
+    // 에디터 월드에서는 보류하지 않음 (BeginPlay가 없으므로)
+    const UWorld* World = GetWorld();
+    if (bPhysicsStateDeferred && World && World->IsGameWorld())
+    {
+        return false;
+    }
+
+    return Super::ShouldCreatePhysicsState();
+}
+
+void UFruitMeshComponent::OnCreatePhysicsState()
+{
+    Super::OnCreatePhysicsState();
+
+    if (BodyInstance.IsValidBodyInstance())
+    {
+        TotalBodyCreations++;
+        INC_DWORD_STAT(STAT_FruitBodyCreations);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/StaticMeshComponent.h"
+#include "FruitMeshComponent.generated.h"
+
+/**
+ * 과일 액터의 루트 메시 컴포넌트
+ * 스폰 설정(타입 메시, 크기, 질량, 충돌 프로필, 시뮬레이션)을 모두 마칠 때까지 물리 바디 생성을 보류하고
+ * 설정이 끝나면 바디를 한 번만 생성 (설정마다 바디를 다시 만들지 않도록)
+ * 게임 월드에서는 생성 직후 보류 상태이며 AFruitBall::BeginPlay 또는 풀에서 꺼낼 때 해제
+ */
+UCLASS(ClassGroup = (Fruit))
+class UE_FRUITMOUNTAIN_API UFruitMeshComponent : public UStaticMeshComponent
+{
+    GENERATED_BODY()
+
+public:
+    // 바디 생성 보류 - 이미 바디가 있으면 제거 (풀 반납/재사용)
+    void DeferPhysicsState();
+
+    // 보류 해제 후 바디 생성 (이미 해제되어 있으면 아무것도 하지 않음)
+    void FinishPhysicsState();
+
+    bool IsPhysicsStateDeferred() const { return bPhysicsStateDeferred; }
+
+    // 모든 과일 메시가 지금까지 바디를 만든 횟수 (스폰 한 번당 생성 횟수 측정용)
+    static uint32 GetTotalBodyCreations() { return TotalBodyCreations; }
+
+protected:
+    virtual bool ShouldCreatePhysicsState() const override;
+    virtual void OnCreatePhysicsState() override;
+
+private:
+    bool bPhysicsStateDeferred = true;
+
+    static uint32 TotalBodyCreations;
+};
\ No newline at end of file
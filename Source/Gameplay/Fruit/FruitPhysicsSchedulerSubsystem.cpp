@@ -0,0 +1,227 @@
+#include "FruitPhysicsSchedulerSubsystem.h"
+#include "Actors/FruitBall.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Physics Scheduler Tick"), STAT_FruitSchedulerTick, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Scheduled Entries"), STAT_FruitScheduledEntries, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scheduled Entries Executed"), STAT_FruitScheduledExecuted, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scheduled Entries Coalesced"), STAT_FruitScheduledCoalesced, STATGROUP_FruitMountain);
+
+bool UFruitPhysicsSchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFruitPhysicsSchedulerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // 물리 시뮬레이션 전에 감쇠/충돌 설정을 반영
+    SchedulerTickFunction.Setup(&InWorld, TG_PrePhysics,
+        [this](float DeltaTime)
+        {
+            ProcessDueEntries();
+        },
+        TEXT("FruitPhysicsScheduler"));
+}
+
+void UFruitPhysicsSchedulerSubsystem::Deinitialize()
+{
+    SchedulerTickFunction.Teardown();
+
+    DEC_DWORD_STAT_BY(STAT_FruitScheduledEntries, Heap.Num());
+    Heap.Empty();
+    KeyToIndex.Empty();
+
+    Super::Deinitialize();
+}
+
+uint64 UFruitPhysicsSchedulerSubsystem::MakeKey(const AFruitBall* Fruit, EFruitScheduledAction Action)
+{
+    return (uint64(Fruit->GetUniqueID()) << 8) | uint64(Action);
+}
+
+void UFruitPhysicsSchedulerSubsystem::Schedule(AFruitBall* Fruit, EFruitScheduledAction Action, float Delay, float Value)
+{
+    UWorld* World = GetWorld();
+    if (!Fruit || !World)
+    {
+        return;
+    }
+
+    const uint64 Key = MakeKey(Fruit, Action);
+    const double DueTime = World->GetTimeSeconds() + Delay;
+
+    // 이미 예약된 작업이면 새 항목 없이 시각/값만 갱신
+    if (const int32* ExistingIndex = KeyToIndex.Find(Key))
+    {
+        const int32 Index = *ExistingIndex;
+        const double OldDueTime = Heap[Index].DueTime;
+        Heap[Index].DueTime = DueTime;
+        Heap[Index].Value = Value;
+
+        if (DueTime < OldDueTime)
+        {
+            SiftUp(Index);
+        }
+        else
+        {
+            SiftDown(Index);
+        }
+
+        INC_DWORD_STAT(STAT_FruitScheduledCoalesced);
+        return;
+    }
+
+    FFruitScheduledEntry& Entry = Heap.AddDefaulted_GetRef();
+    Entry.Fruit = Fruit;
+    Entry.Key = Key;
+    Entry.DueTime = DueTime;
+    Entry.Value = Value;
+    Entry.Action = Action;
+
+    const int32 NewIndex = Heap.Num() - 1;
+    KeyToIndex.Add(Key, NewIndex);
+    SiftUp(NewIndex);
+
+    INC_DWORD_STAT(STAT_FruitScheduledEntries);
+}
+
+void UFruitPhysicsSchedulerSubsystem::CancelAll(AFruitBall* Fruit)
+{
+    if (!Fruit || Heap.Num() == 0)
+    {
+        return;
+    }
+
+    for (EFruitScheduledAction Action : { EFruitScheduledAction::RestoreDamping, EFruitScheduledAction::RestoreAngularDamping, EFruitScheduledAction::EnableCollision })
+    {
+        if (const int32* Index = KeyToIndex.Find(MakeKey(Fruit, Action)))
+        {
+            RemoveAt(*Index);
+        }
+    }
+}
+
+void UFruitPhysicsSchedulerSubsystem::ProcessDueEntries()
+{
+    SCOPE_CYCLE_COUNTER(STAT_FruitSchedulerTick);
+
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    while (Heap.Num() > 0 && Heap[0].DueTime <= Now)
+    {
+        // 실행 중 다시 예약될 수 있으므로 먼저 꺼낸 뒤 실행
+        const FFruitScheduledEntry Entry = Heap[0];
+        RemoveAt(0);
+
+        Execute(Entry);
+        INC_DWORD_STAT(STAT_FruitScheduledExecuted);
+    }
+}
+
+void UFruitPhysicsSchedulerSubsystem::Execute(const FFruitScheduledEntry& Entry)
+{
+    AFruitBall* Fruit = Entry.Fruit.Get();
+    if (!IsValid(Fruit) || Fruit->IsInPool())
+    {
+        return;
+    }
+
+    UStaticMeshComponent* MeshComp = Fruit->GetMeshComponent();
+    if (!MeshComp)
+    {
+        return;
+    }
+
+    switch (Entry.Action)
+    {
+    case EFruitScheduledAction::RestoreDamping:
+        MeshComp->SetLinearDamping(Entry.Value);
+        MeshComp->SetAngularDamping(Entry.Value);
+        break;
+
+    case EFruitScheduledAction::RestoreAngularDamping:
+        if (MeshComp->IsSimulatingPhysics())
+        {
+            MeshComp->SetAngularDamping(Entry.Value);
+        }
+        break;
+
+    case EFruitScheduledAction::EnableCollision:
+        MeshComp->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+        break;
+    }
+}
+
+void UFruitPhysicsSchedulerSubsystem::SwapEntries(int32 A, int32 B)
+{
+    Heap.Swap(A, B);
+    KeyToIndex[Heap[A].Key] = A;
+    KeyToIndex[Heap[B].Key] = B;
+}
+
+void UFruitPhysicsSchedulerSubsystem::SiftUp(int32 Index)
+{
+    while (Index > 0)
+    {
+        const int32 Parent = (Index - 1) / 2;
+        if (Heap[Parent].DueTime <= Heap[Index].DueTime)
+        {
+            break;
+        }
+        SwapEntries(Parent, Index);
+        Index = Parent;
+    }
+}
+
+void UFruitPhysicsSchedulerSubsystem::SiftDown(int32 Index)
+{
+    const int32 Num = Heap.Num();
+    while (true)
+    {
+        const int32 Left = Index * 2 + 1;
+        const int32 Right = Left + 1;
+        int32 Smallest = Index;
+
+        if (Left < Num && Heap[Left].DueTime < Heap[Smallest].DueTime)
+        {
+            Smallest = Left;
+        }
+        if (Right < Num && Heap[Right].DueTime < Heap[Smallest].DueTime)
+        {
+            Smallest = Right;
+        }
+        if (Smallest == Index)
+        {
+            break;
+        }
+
+        SwapEntries(Index, Smallest);
+        Index = Smallest;
+    }
+}
+
+void UFruitPhysicsSchedulerSubsystem::RemoveAt(int32 Index)
+{
+    KeyToIndex.Remove(Heap[Index].Key);
+
+    // 마지막 항목을 빈 자리로 옮긴 뒤 힙 순서 복원
+    const int32 LastIndex = Heap.Num() - 1;
+    if (Index != LastIndex)
+    {
+        Heap[Index] = Heap[LastIndex];
+        KeyToIndex[Heap[Index].Key] = Index;
+    }
+    Heap.RemoveAt(LastIndex, 1, EAllowShrinking::No);
+
+    if (Index < Heap.Num())
+    {
+        SiftUp(Index);
+        SiftDown(Index);
+    }
+
+    DEC_DWORD_STAT(STAT_FruitScheduledEntries);
+}
\ No newline at end of file
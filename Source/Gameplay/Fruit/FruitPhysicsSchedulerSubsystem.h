@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "System/Tick/FruitTickFunction.h"
+#include "FruitPhysicsSchedulerSubsystem.generated.h"
+
+class AFruitBall;
+
+// 예약 가능한 과일 물리 작업 (과일 하나당 작업마다 최대 한 개)
+enum class EFruitScheduledAction : uint8
+{
+    // 선형/각 감쇠를 Value로 복원 (병합 안정화 후)
+    RestoreDamping,
+
+    // 각 감쇠만 Value로 복원 (접시 충돌 후)
+    RestoreAngularDamping,
+
+    // 충돌 다시 켜기 (병합으로 새로 생긴 과일)
+    EnableCollision,
+};
+
+// 예약 항목
+struct FFruitScheduledEntry
+{
+    TWeakObjectPtr<AFruitBall> Fruit;
+
+    // 과일 UniqueID와 작업 종류로 만든 키
+    uint64 Key = 0;
+
+    // 실행 시각 (월드 게임 시간, 시간 감속 반영)
+    double DueTime = 0.0;
+
+    float Value = 0.0f;
+    EFruitScheduledAction Action = EFruitScheduledAction::RestoreDamping;
+};
+
+/**
+ * 과일별 FTimerManager 람다 대신 쓰는 물리 작업 예약기
+ * 실행 시각 기준 최소 힙 + 키 -> 힙 위치 맵으로 관리하고, 같은 과일/작업을 다시 예약하면 기존 항목의 시각만 갱신
+ * 프레임당 한 번(TG_PrePhysics) 만료된 항목만 꺼내 실행
+ */
+UCLASS()
+class UE_FRUITMOUNTAIN_API UFruitPhysicsSchedulerSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    // Delay초 뒤 작업 예약 (이미 예약돼 있으면 시각과 값만 갱신)
+    void Schedule(AFruitBall* Fruit, EFruitScheduledAction Action, float Delay, float Value = 0.0f);
+
+    // 과일의 예약 작업 모두 취소 (풀 반납 시)
+    void CancelAll(AFruitBall* Fruit);
+
+    int32 GetNumScheduled() const { return Heap.Num(); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // 만료된 항목 실행
+    void ProcessDueEntries();
+
+    static uint64 MakeKey(const AFruitBall* Fruit, EFruitScheduledAction Action);
+
+    static void Execute(const FFruitScheduledEntry& Entry);
+
+    // 힙 조작 (KeyToIndex 동기화 포함)
+    void SiftUp(int32 Index);
+    void SiftDown(int32 Index);
+    void SwapEntries(int32 A, int32 B);
+    void RemoveAt(int32 Index);
+
+    FFruitTickFunction SchedulerTickFunction;
+
+    TArray<FFruitScheduledEntry> Heap;
+    TMap<uint64, int32> KeyToIndex;
+};
\ No newline at end of file
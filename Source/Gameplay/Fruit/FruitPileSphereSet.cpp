@@ -0,0 +1,302 @@
+#include "FruitPileSphereSet.h"
+#include "Actors/FruitBall.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Pile Sphere Build"), STAT_FruitPileSphereBuild, STATGROUP_FruitMountain);
+DECLARE_CYCLE_STAT(TEXT("Pile Sweep"), STAT_FruitPileSweep, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pile Spheres"), STAT_FruitPileSpheres, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pile Sweep Candidates"), STAT_FruitPileSweepCandidates, STATGROUP_FruitMountain);
+
+FFruitPileSphereSet::FFruitPileSphereSet()
+    : Bounds(ForceInit)
+    , Grid(AFruitBall::CalculateBallSize(AFruitBall::MaxBallType))
+{
+}
+
+void FFruitPileSphereSet::Reset()
+{
+    Centers.Reset();
+    Radii.Reset();
+    MaxRadius = 0.0f;
+    Bounds = FBox(ForceInit);
+    Grid.Reset();
+}
+
+void FFruitPileSphereSet::Add(const FVector& Center, float Radius)
+{
+    Centers.Add(Center);
+    Radii.Add(Radius);
+    MaxRadius = FMath::Max(MaxRadius, Radius);
+}
+
+void FFruitPileSphereSet::Build()
+{
+    SCOPE_CYCLE_COUNTER(STAT_FruitPileSphereBuild);
+
+    Bounds = FBox(ForceInit);
+    for (int32 Index = 0; Index < Centers.Num(); Index++)
+    {
+        Bounds += FBox::BuildAABB(Centers[Index], FVector(Radii[Index]));
+    }
+
+    Grid.Build(Centers);
+
+    SET_DWORD_STAT(STAT_FruitPileSpheres, Centers.Num());
+}
+
+bool FFruitPileSphereSet::IntersectSegment(const FVector& Start, const FVector& Delta, int32 SphereIndex, float ProbeRadius, float& OutAlpha) const
+{
+    // |Start + Delta*s - Center|^2 = R^2 의 작은 근
+    const FVector ToStart = Start - Centers[SphereIndex];
+    const float CombinedRadius = Radii[SphereIndex] + ProbeRadius;
+    const float C = ToStart.SizeSquared() - CombinedRadius * CombinedRadius;
+    if (C <= 0.0f)
+    {
+        // 시작점이 이미 겹쳐 있음
+        OutAlpha = 0.0f;
+        return true;
+    }
+
+    const float A = Delta.SizeSquared();
+    const float B = FVector::DotProduct(ToStart, Delta);
+    if (B >= 0.0f || A <= UE_SMALL_NUMBER)
+    {
+        // 구에서 멀어지는 방향
+        return false;
+    }
+
+    const float Discriminant = B * B - A * C;
+    if (Discriminant < 0.0f)
+    {
+        return false;
+    }
+
+    const float Alpha = (-B - FMath::Sqrt(Discriminant)) / A;
+    if (Alpha > 1.0f)
+    {
+        return false;
+    }
+
+    OutAlpha = Alpha;
+    return true;
+}
+
+bool FFruitPileSphereSet::SweepSegment(const FVector& Start, const FVector& End, float ProbeRadius, TConstArrayView<int32> Candidates, int32& OutSphere, float& OutAlpha) const
+{
+    const FVector Delta = End - Start;
+    bool bHit = false;
+    for (int32 SphereIndex : Candidates)
+    {
+        float Alpha = 0.0f;
+        if (IntersectSegment(Start, Delta, SphereIndex, ProbeRadius, Alpha) && (!bHit || Alpha < OutAlpha))
+        {
+            OutSphere = SphereIndex;
+            OutAlpha = Alpha;
+            bHit = true;
+        }
+    }
+    return bHit;
+}
+
+void FFruitPileSphereSet::FillContact(TConstArrayView<FVector> Points, int32 SegmentIndex, int32 SphereIndex, float Alpha, FFruitPileContact& OutContact) const
+{
+    OutContact.SegmentIndex = SegmentIndex;
+    OutContact.SphereIndex = SphereIndex;
+    OutContact.ProbeCenter = FMath::Lerp(Points[SegmentIndex], Points[SegmentIndex + 1], Alpha);
+
+    // 더미 과일 중심에서 날아가는 과일 중심 방향으로 표면까지
+    const FVector Normal = (OutContact.ProbeCenter - Centers[SphereIndex]).GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+    OutContact.Location = Centers[SphereIndex] + Normal * Radii[SphereIndex];
+}
+
+bool FFruitPileSphereSet::SweepPath(TConstArrayView<FVector> Points, float ProbeRadius, FFruitPileContact& OutContact) const
+{
+    if (Centers.Num() == 0 || Points.Num() < 2)
+    {
+        return false;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_FruitPileSweep);
+
+    const FBox SweepBounds = Bounds.ExpandBy(ProbeRadius);
+    int32 NumCandidates = 0;
+
+    for (int32 SegmentIndex = 0; SegmentIndex < Points.Num() - 1; SegmentIndex++)
+    {
+        const FVector& Start = Points[SegmentIndex];
+        const FVector& End = Points[SegmentIndex + 1];
+
+        // 더미 바운드와 겹치지 않는 선분은 격자 질의 없이 건너뜀
+        if (!SweepBounds.Intersect(FBox(Start.ComponentMin(End), Start.ComponentMax(End))))
+        {
+            continue;
+        }
+
+        // 선분 중점 기준으로 선분 절반 + 구 반지름 + 탐사 반지름 안의 중심만 후보
+        const FVector Mid = (Start + End) * 0.5f;
+        const float QueryRadius = FVector::Dist(Start, End) * 0.5f + MaxRadius + ProbeRadius;
+
+        CandidateScratch.Reset();
+        Grid.QueryRadius(Mid, QueryRadius, Centers, CandidateScratch);
+        NumCandidates += CandidateScratch.Num();
+
+        int32 SphereIndex = INDEX_NONE;
+        float Alpha = 0.0f;
+        if (SweepSegment(Start, End, ProbeRadius, CandidateScratch, SphereIndex, Alpha))
+        {
+            FillContact(Points, SegmentIndex, SphereIndex, Alpha, OutContact);
+            SET_DWORD_STAT(STAT_FruitPileSweepCandidates, NumCandidates);
+            return true;
+        }
+    }
+
+    SET_DWORD_STAT(STAT_FruitPileSweepCandidates, NumCandidates);
+    return false;
+}
+
+bool FFruitPileSphereSet::SweepPathBruteForce(TConstArrayView<FVector> Points, float ProbeRadius, FFruitPileContact& OutContact) const
+{
+    if (Centers.Num() == 0 || Points.Num() < 2)
+    {
+        return false;
+    }
+
+    CandidateScratch.SetNumUninitialized(Centers.Num(), EAllowShrinking::No);
+    for (int32 Index = 0; Index < Centers.Num(); Index++)
+    {
+        CandidateScratch[Index] = Index;
+    }
+
+    for (int32 SegmentIndex = 0; SegmentIndex < Points.Num() - 1; SegmentIndex++)
+    {
+        int32 SphereIndex = INDEX_NONE;
+        float Alpha = 0.0f;
+        if (SweepSegment(Points[SegmentIndex], Points[SegmentIndex + 1], ProbeRadius, CandidateScratch, SphereIndex, Alpha))
+        {
+            FillContact(Points, SegmentIndex, SphereIndex, Alpha, OutContact);
+            return true;
+        }
+    }
+    return false;
+}
+
+// 더미 충돌 궤적 예측 벤치마크 - 가상의 더미에 여러 각도로 던진 궤적을 격자/전체 검사로 비교
+// 사용법: Fruit.Bench.PileTrajectory [과일 수] [반복 횟수]
+static void RunPileTrajectoryBenchmark(const TArray<FString>& Args)
+{
+    const int32 NumFruits = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 500;
+    const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 200;
+
+    const float PlateRadius = 100.0f;
+    const float GravityZ = -980.0f;
+    const float ProbeRadius = AFruitBall::CalculateBallSize(1) * 0.5f;
+
+    FRandomStream Random(1234);
+
+    // 접시 위에 원뿔 형태로 쌓인 더미 (높이는 과일 수에 비례)
+    const float PileHeight = FMath::Max(30.0f, NumFruits * 0.2f);
+    TArray<FVector> PileCenters;
+    TArray<float> PileRadii;
+    for (int32 i = 0; i < NumFruits; i++)
+    {
+        const float Theta = Random.FRand() * UE_TWO_PI;
+        const float Dist = PlateRadius * FMath::Sqrt(Random.FRand());
+        const float Height = PileHeight * (1.0f - Dist / PlateRadius) * Random.FRand();
+        PileCenters.Add(FVector(Dist * FMath::Cos(Theta), Dist * FMath::Sin(Theta), Height));
+        PileRadii.Add(AFruitBall::CalculateBallSize(1 + Random.RandHelper(AFruitBall::RandomBallTypeMax)) * 0.5f);
+    }
+
+    // 접시 둘레에서 중심을 향해 여러 각도로 던진 궤적 (0.04초 간격 샘플)
+    TArray<TArray<FVector>> Paths;
+    const FVector Target(0.0f, 0.0f, 0.0f);
+    for (float Yaw = 0.0f; Yaw < 360.0f; Yaw += 45.0f)
+    {
+        const FVector Start = FRotator(0.0f, Yaw, 0.0f).Vector() * (PlateRadius + 50.0f) + FVector(0.0f, 0.0f, PileHeight + 50.0f);
+        const FVector ToTarget = Target - Start;
+        const float Range = ToTarget.Size2D();
+        const FVector Horizontal = FVector(ToTarget.X, ToTarget.Y, 0.0f).GetSafeNormal();
+
+        for (float Angle = 20.0f; Angle <= 70.0f; Angle += 10.0f)
+        {
+            // 목표를 지나는 포물선의 발사 속력
+            const float TanAngle = FMath::Tan(FMath::DegreesToRadians(Angle));
+            const float Denominator = 2.0f * FMath::Square(FMath::Cos(FMath::DegreesToRadians(Angle))) * (Range * TanAngle - ToTarget.Z);
+            if (Denominator <= 0.0f) continue;
+
+            const float Speed = FMath::Sqrt(-GravityZ * Range * Range / Denominator);
+            const FVector Velocity = (Horizontal + FVector(0.0f, 0.0f, TanAngle)).GetSafeNormal() * Speed;
+
+            TArray<FVector>& Points = Paths.AddDefaulted_GetRef();
+            for (float Time = 0.0f; Time < 5.0f; Time += 0.04f)
+            {
+                const FVector Point = Start + Velocity * Time + FVector(0.0f, 0.0f, 0.5f * GravityZ * Time * Time);
+                Points.Add(Point);
+                if (Point.Z < -50.0f) break;
+            }
+        }
+    }
+
+    FFruitPileSphereSet Set;
+    FFruitPileContact Contact;
+
+    // 1) 매 갱신마다 구 집합 구성
+    const double BuildStart = FPlatformTime::Seconds();
+    for (int32 Iter = 0; Iter < Iterations; Iter++)
+    {
+        Set.Reset();
+        for (int32 i = 0; i < NumFruits; i++)
+        {
+            Set.Add(PileCenters[i], PileRadii[i]);
+        }
+        Set.Build();
+    }
+    const double BuildUs = (FPlatformTime::Seconds() - BuildStart) * 1000000.0 / Iterations;
+
+    // 2) 격자 검사
+    int32 GridHits = 0;
+    const double GridStart = FPlatformTime::Seconds();
+    for (int32 Iter = 0; Iter < Iterations; Iter++)
+    {
+        for (const TArray<FVector>& Points : Paths)
+        {
+            GridHits += Set.SweepPath(Points, ProbeRadius, Contact) ? 1 : 0;
+        }
+    }
+    const double GridUs = (FPlatformTime::Seconds() - GridStart) * 1000000.0 / (Iterations * Paths.Num());
+
+    // 3) 전체 검사 (비교용) - 결과가 격자 검사와 같은지도 확인
+    int32 BruteHits = 0;
+    int32 Mismatches = 0;
+    const double BruteStart = FPlatformTime::Seconds();
+    for (int32 Iter = 0; Iter < Iterations; Iter++)
+    {
+        for (const TArray<FVector>& Points : Paths)
+        {
+            BruteHits += Set.SweepPathBruteForce(Points, ProbeRadius, Contact) ? 1 : 0;
+        }
+    }
+    const double BruteUs = (FPlatformTime::Seconds() - BruteStart) * 1000000.0 / (Iterations * Paths.Num());
+
+    for (const TArray<FVector>& Points : Paths)
+    {
+        FFruitPileContact GridContact;
+        FFruitPileContact BruteContact;
+        const bool bGridHit = Set.SweepPath(Points, ProbeRadius, GridContact);
+        const bool bBruteHit = Set.SweepPathBruteForce(Points, ProbeRadius, BruteContact);
+        if (bGridHit != bBruteHit || (bGridHit && !GridContact.ProbeCenter.Equals(BruteContact.ProbeCenter, 0.01f)))
+        {
+            Mismatches++;
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("[Fruit.Bench.PileTrajectory] 과일 %d개, 궤적 %d개 x %d회: 구 집합 구성 %.2f us | 격자 검사 %.2f us/궤적 | 전체 검사 %.2f us/궤적 (%.1f배) | 접촉 %d/%d (전체 검사 %d), 불일치 %d"),
+        NumFruits, Paths.Num(), Iterations, BuildUs, GridUs, BruteUs, GridUs > 0.0 ? BruteUs / GridUs : 0.0,
+        GridHits / Iterations, Paths.Num(), BruteHits / Iterations, Mismatches);
+}
+
+static FAutoConsoleCommand PileTrajectoryBenchmarkCommand(
+    TEXT("Fruit.Bench.PileTrajectory"),
+    TEXT("과일 더미 충돌 궤적 예측 비용 측정 (갱신당 구 집합 구성 + 격자 검사 vs 전체 검사). 인자: [과일 수] [반복 횟수]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunPileTrajectoryBenchmark));
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FruitSpatialHash.h"
+
+// 궤적과 과일 더미의 첫 접촉 정보
+struct FFruitPileContact
+{
+    // 접촉한 궤적 선분 (Points[SegmentIndex] -> Points[SegmentIndex + 1])
+    int32 SegmentIndex = INDEX_NONE;
+
+    // 접촉 순간 날아가는 과일의 중심
+    FVector ProbeCenter = FVector::ZeroVector;
+
+    // 더미 과일 표면의 접촉 지점
+    FVector Location = FVector::ZeroVector;
+
+    // 접촉한 구 인덱스 (FFruitPileSphereSet 기준)
+    int32 SphereIndex = INDEX_NONE;
+};
+
+/**
+ * 궤적 예측용 과일 더미 단순화 - 과일을 구(중심, 반지름)로만 보관
+ * 중심/반지름은 따로 모은 연속 배열이고, 격자(FFruitSpatialHash)로 선분 주변 구만 검사
+ * 물리 씬 트레이스 없이 궤적 선분과 구의 교차만 계산
+ */
+class UE_FRUITMOUNTAIN_API FFruitPileSphereSet
+{
+public:
+    FFruitPileSphereSet();
+
+    // 구 목록 비우기 (메모리는 유지)
+    void Reset();
+
+    // 구 추가 - 모두 추가한 뒤 Build 호출
+    void Add(const FVector& Center, float Radius);
+
+    // 격자와 전체 바운드 구성
+    void Build();
+
+    // 궤적 포인트를 순서대로 따라가며 반지름 ProbeRadius 구가 처음 닿는 지점 찾기
+    bool SweepPath(TConstArrayView<FVector> Points, float ProbeRadius, FFruitPileContact& OutContact) const;
+
+    // 비교용 - 격자 없이 선분마다 모든 구 검사 (벤치마크 전용)
+    bool SweepPathBruteForce(TConstArrayView<FVector> Points, float ProbeRadius, FFruitPileContact& OutContact) const;
+
+    int32 Num() const { return Centers.Num(); }
+
+private:
+    // 선분과 구(반지름 = 구 반지름 + ProbeRadius)의 첫 교차 비율 (0..1, 없으면 false)
+    bool IntersectSegment(const FVector& Start, const FVector& Delta, int32 SphereIndex, float ProbeRadius, float& OutAlpha) const;
+
+    // 선분 하나에서 후보 구 중 가장 먼저 닿는 구 (OutAlpha 갱신)
+    bool SweepSegment(const FVector& Start, const FVector& End, float ProbeRadius, TConstArrayView<int32> Candidates, int32& OutSphere, float& OutAlpha) const;
+
+    void FillContact(TConstArrayView<FVector> Points, int32 SegmentIndex, int32 SphereIndex, float Alpha, FFruitPileContact& OutContact) const;
+
+    // 구 중심과 반지름 (같은 인덱스)
+    TArray<FVector> Centers;
+    TArray<float> Radii;
+
+    // 가장 큰 구 반지름 (선분 질의 반경 확장용)
+    float MaxRadius = 0.0f;
+
+    // 전체 구를 감싸는 박스 (궤적 대부분은 더미 위를 지나므로 먼저 걸러 냄)
+    FBox Bounds;
+
+    // 구 중심 격자 (셀 크기 = 최대 과일 크기)
+    FFruitSpatialHash Grid;
+
+    // 후보 구 임시 버퍼
+    mutable TArray<int32> CandidateScratch;
+};
\ No newline at end of file
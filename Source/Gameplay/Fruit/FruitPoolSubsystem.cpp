@@ -0,0 +1,157 @@
+#include "FruitPoolSubsystem.h"
+#include "Actors/FruitBall.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Hits"), STAT_FruitPoolHits, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Misses"), STAT_FruitPoolMisses, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool High Water Mark"), STAT_FruitPoolHighWater, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Free Fruits"), STAT_FruitPoolFree, STATGROUP_FruitMountain);
+
+static TAutoConsoleVariable<int32> CVarFruitPoolSize(
+    TEXT("Fruit.Pool.Size"),
+    64,
+    TEXT("미리 만들어 두고 보관할 과일 액터 수 (게임 시작 시 적용, 반납 시 이 수를 넘으면 제거)"),
+    ECVF_Default);
+
+const FVector UFruitPoolSubsystem::ParkingLocation = FVector(0.0f, 0.0f, -10000.0f);
+
+bool UFruitPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+int32 UFruitPoolSubsystem::GetConfiguredPoolSize()
+{
+    return FMath::Max(0, CVarFruitPoolSize.GetValueOnGameThread());
+}
+
+void UFruitPoolSubsystem::Deinitialize()
+{
+    SET_DWORD_STAT(STAT_FruitPoolFree, 0);
+
+    // 월드가 정리되면서 액터도 함께 제거되므로 참조만 정리
+    FreeFruits.Empty();
+    NumCheckedOut = 0;
+
+    Super::Deinitialize();
+}
+
+AFruitBall* UFruitPoolSubsystem::BeginSpawnPooledFruit(TSubclassOf<AActor> FruitClass, const FTransform& SpawnTransform, AActor* Owner)
+{
+    UWorld* World = GetWorld();
+    if (!World || !FruitClass || !FruitClass->IsChildOf(AFruitBall::StaticClass()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FruitPool: 유효하지 않은 과일 클래스"));
+        return nullptr;
+    }
+
+    // BeginPlay(바디 생성)는 FinishSpawning에서 실행
+    return World->SpawnActorDeferred<AFruitBall>(FruitClass, SpawnTransform, Owner, nullptr,
+        ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+}
+
+void UFruitPoolSubsystem::Prewarm(TSubclassOf<AActor> FruitClass, int32 Count)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    int32 Created = 0;
+    while (FreeFruits.Num() < Count)
+    {
+        const FTransform SpawnTransform(ParkingLocation);
+        AFruitBall* Fruit = BeginSpawnPooledFruit(FruitClass, SpawnTransform, nullptr);
+        if (!Fruit) break;
+
+        // 보관 상태로 BeginPlay를 맞으므로 바디/레지스트리 등록 없이 대기
+        Fruit->OnReturnedToPool(ParkingLocation);
+        Fruit->FinishSpawning(SpawnTransform);
+        FreeFruits.Add(Fruit);
+        Created++;
+    }
+
+    SET_DWORD_STAT(STAT_FruitPoolFree, FreeFruits.Num());
+
+    UE_LOG(LogTemp, Display, TEXT("FruitPool: 과일 %d개 미리 생성 (%.2f ms)"),
+        Created, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+AFruitBall* UFruitPoolSubsystem::Acquire(TSubclassOf<AActor> FruitClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, int32 BallType, bool bEnablePhysics)
+{
+    AFruitBall* Fruit = nullptr;
+
+    // 같은 클래스의 대기 과일 찾기 (뒤에서부터 꺼내 배열 이동 최소화)
+    for (int32 Index = FreeFruits.Num() - 1; Index >= 0; Index--)
+    {
+        AFruitBall* Candidate = FreeFruits[Index];
+        if (!IsValid(Candidate))
+        {
+            FreeFruits.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+            continue;
+        }
+
+        if (Candidate->GetClass() == FruitClass.Get())
+        {
+            FreeFruits.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+            Fruit = Candidate;
+            break;
+        }
+    }
+
+    if (Fruit)
+    {
+        INC_DWORD_STAT(STAT_FruitPoolHits);
+
+        Fruit->SetOwner(Owner);
+        Fruit->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+        Fruit->OnCheckedOutFromPool(BallType, bEnablePhysics);
+    }
+    else
+    {
+        INC_DWORD_STAT(STAT_FruitPoolMisses);
+
+        const FTransform SpawnTransform(Rotation, Location);
+        Fruit = BeginSpawnPooledFruit(FruitClass, SpawnTransform, Owner);
+        if (!Fruit)
+        {
+            return nullptr;
+        }
+
+        // 바디를 만들기 전에 모든 설정 적용 (바디는 FinishSpawning의 BeginPlay에서 한 번 생성)
+        Fruit->ConfigureForSpawn(BallType, bEnablePhysics);
+        Fruit->FinishSpawning(SpawnTransform);
+    }
+
+    NumCheckedOut++;
+    if (NumCheckedOut > HighWaterMark)
+    {
+        HighWaterMark = NumCheckedOut;
+        SET_DWORD_STAT(STAT_FruitPoolHighWater, HighWaterMark);
+    }
+    SET_DWORD_STAT(STAT_FruitPoolFree, FreeFruits.Num());
+
+    return Fruit;
+}
+
+void UFruitPoolSubsystem::Release(AFruitBall* Fruit)
+{
+    // 이미 반납된 과일은 중복 처리하지 않음
+    if (!IsValid(Fruit) || Fruit->IsInPool())
+    {
+        return;
+    }
+
+    NumCheckedOut = FMath::Max(0, NumCheckedOut - 1);
+
+    // 풀이 가득 찼으면 보관하지 않고 제거
+    if (FreeFruits.Num() >= GetConfiguredPoolSize())
+    {
+        Fruit->Destroy();
+        return;
+    }
+
+    Fruit->OnReturnedToPool(ParkingLocation);
+    FreeFruits.Add(Fruit);
+
+    SET_DWORD_STAT(STAT_FruitPoolFree, FreeFruits.Num());
+}
\ No newline at end of file
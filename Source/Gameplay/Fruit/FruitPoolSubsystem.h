@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FruitPoolSubsystem.generated.h"
+
+class AFruitBall;
+
+/**
+ * AFruitBall 액터 풀
+ * 던지기, 미리보기, 병합에서 SpawnActor/Destroy 대신 미리 만들어 둔 과일을 꺼내 쓰고 돌려받음
+ * 풀 크기는 Fruit.Pool.Size 콘솔 변수로 조절
+ */
+UCLASS()
+class UE_FRUITMOUNTAIN_API UFruitPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // 풀 미리 채우기 (게임모드 BeginPlay에서 호출)
+    void Prewarm(TSubclassOf<AActor> FruitClass, int32 Count);
+
+    // 과일 꺼내기 - 풀에 없으면 새로 스폰 (미스)
+    // 타입/크기/질량/충돌/물리를 모두 설정한 뒤 바디를 한 번만 만들어 반환
+    AFruitBall* Acquire(TSubclassOf<AActor> FruitClass, const FVector& Location, const FRotator& Rotation, AActor* Owner, int32 BallType, bool bEnablePhysics);
+
+    // 과일 반납 - 숨기고 물리를 끈 뒤 보관 위치로 이동 (풀이 가득 차면 제거)
+    void Release(AFruitBall* Fruit);
+
+    // 콘솔 변수에 설정된 풀 크기
+    static int32 GetConfiguredPoolSize();
+
+    // 반납된 과일을 보관하는 위치 (월드 아래쪽)
+    static const FVector ParkingLocation;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // 과일 한 개 지연 스폰 - 호출한 쪽에서 설정 후 FinishSpawning 호출
+    AFruitBall* BeginSpawnPooledFruit(TSubclassOf<AActor> FruitClass, const FTransform& SpawnTransform, AActor* Owner);
+
+    // 대기 중인 과일
+    UPROPERTY()
+    TArray<AFruitBall*> FreeFruits;
+
+    // 현재 사용 중인 과일 수 / 최대치
+    int32 NumCheckedOut = 0;
+    int32 HighWaterMark = 0;
+};
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "FruitPreviewComponent.h"
+#include "FruitSpawnHelper.h"
+#include "FruitTypeCatalog.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/StaticMesh.h"
+#include "System/Asset/FruitAssetSubsystem.h"
+#include "UObject/ConstructorHelpers.h"
+
+UFruitPreviewComponent::UFruitPreviewComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+
+    // 보이기만 함 (충돌/물리/오버랩 없음)
+    SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+    SetGenerateOverlapEvents(false);
+    SetSimulatePhysics(false);
+    SetCanEverAffectNavigation(false);
+    SetMobility(EComponentMobility::Movable);
+
+    // 폰(카메라)이 움직여도 미리보기 위치는 월드 기준
+    SetUsingAbsoluteLocation(true);
+    SetUsingAbsoluteRotation(true);
+    SetUsingAbsoluteScale(true);
+
+    // 공 타입을 받기 전까지는 숨김
+    SetVisibility(false);
+
+    // 비동기 로드 전에 보여 줄 기본 메시 (AFruitBall과 같은 타입 1 메시)
+    static ConstructorHelpers::FObjectFinder<UStaticMesh> DefaultMeshAsset(TEXT("/Game/Fruit/Meshes/Fruit1"));
+    if (DefaultMeshAsset.Succeeded())
+    {
+        SetStaticMesh(DefaultMeshAsset.Object);
+    }
+}
+
+void UFruitPreviewComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UFruitAssetSubsystem* Assets = UFruitAssetSubsystem::Get(this))
+    {
+        if (!Assets->AreAssetsReady())
+        {
+            AssetsReadyHandle = Assets->OnAssetsReady.AddUObject(this, &UFruitPreviewComponent::HandleAssetsReady);
+        }
+    }
+}
+
+void UFruitPreviewComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (AssetsReadyHandle.IsValid())
+    {
+        if (UFruitAssetSubsystem* Assets = UFruitAssetSubsystem::Get(this))
+        {
+            Assets->OnAssetsReady.Remove(AssetsReadyHandle);
+        }
+        AssetsReadyHandle.Reset();
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UFruitPreviewComponent::ShowBallType(int32 BallType)
+{
+    if (BallType != DisplayedBallType)
+    {
+        ApplyBallType(BallType);
+    }
+
+    if (!IsVisible())
+    {
+        SetVisibility(true);
+    }
+}
+
+void UFruitPreviewComponent::HidePreview()
+{
+    if (IsVisible())
+    {
+        SetVisibility(false);
+    }
+}
+
+void UFruitPreviewComponent::ApplyBallType(int32 BallType)
+{
+    DisplayedBallType = BallType;
+
+    // 아직 로드 중이면 현재 메시를 유지하고 로드 완료 시 다시 적용
+    if (UStaticMesh* NewMesh = FFruitTypeTable::Get(BallType).Mesh.Get())
+    {
+        if (GetStaticMesh() != NewMesh)
+        {
+            SetStaticMesh(NewMesh);
+        }
+    }
+
+    // 실제로 던지는 과일과 같은 크기
+    SetWorldScale3D(FVector(UFruitSpawnHelper::CalculateBallSize(BallType)));
+}
+
+void UFruitPreviewComponent::HandleAssetsReady()
+{
+    AssetsReadyHandle.Reset();
+
+    if (DisplayedBallType > 0)
+    {
+        ApplyBallType(DisplayedBallType);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/StaticMeshComponent.h"
+#include "FruitPreviewComponent.generated.h"
+
+/**
+ * 던지기 미리보기 과일 - 플레이어 폰이 계속 들고 있는 가벼운 메시 컴포넌트
+ * 틱/충돌/물리 없이 보이기만 하고, 공 타입이 바뀌면 타입 테이블의 메시와 크기로 교체
+ * 던지는 동안에는 제거하지 않고 숨김 (액터 스폰/제거 없음)
+ * 위치/회전/크기는 절대값으로 사용 (폰 카메라 이동과 무관)
+ */
+UCLASS(ClassGroup = (Fruit), meta = (BlueprintSpawnableComponent))
+class UE_FRUITMOUNTAIN_API UFruitPreviewComponent : public UStaticMeshComponent
+{
+    GENERATED_BODY()
+
+public:
+    UFruitPreviewComponent();
+
+    // 공 타입의 메시/크기로 바꾸고 표시 - 같은 타입이면 메시/크기는 그대로
+    void ShowBallType(int32 BallType);
+
+    // 미리보기 숨기기 (던지는 중, 게임 오버)
+    void HidePreview();
+
+    int32 GetDisplayedBallType() const { return DisplayedBallType; }
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    // 타입 테이블의 메시와 크기 적용 (메시가 아직 로드 중이면 현재 메시 유지)
+    void ApplyBallType(int32 BallType);
+
+    // 에셋 로드가 끝나면 기본 메시를 실제 메시로 교체
+    void HandleAssetsReady();
+
+    int32 DisplayedBallType = 0;
+
+    FDelegateHandle AssetsReadyHandle;
+};
\ No newline at end of file
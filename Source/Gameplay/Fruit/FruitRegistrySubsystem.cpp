@@ -0,0 +1,384 @@
+#include "FruitRegistrySubsystem.h"
+#include "Actors/FruitBall.h"
+#include "Components/StaticMeshComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Fruits"), STAT_FruitRegistered, STATGROUP_FruitMountain);
+DECLARE_CYCLE_STAT(TEXT("Fruit Spatial Hash Build"), STAT_FruitSpatialHashBuild, STATGROUP_FruitMountain);
+DECLARE_CYCLE_STAT(TEXT("Fruit Fall Sweep"), STAT_FruitFallSweep, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fruit Fall Swept"), STAT_FruitFallSwept, STATGROUP_FruitMountain);
+DECLARE_CYCLE_STAT(TEXT("Fruit Sleep Update"), STAT_FruitSleepUpdate, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Awake Fruit Bodies"), STAT_FruitAwakeBodies, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fruits Put To Sleep"), STAT_FruitPutToSleep, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fruits Woken"), STAT_FruitWoken, STATGROUP_FruitMountain);
+
+static TAutoConsoleVariable<int32> CVarFruitFallPerFruitTick(
+    TEXT("Fruit.Fall.PerFruitTick"),
+    0,
+    TEXT("1: 과일마다 Tick으로 추락 감지 (기존 방식, 비교용), 0: 레지스트리에서 한 번에 감지 (새로 생성/꺼낸 과일부터 적용)"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFruitSleepWindow(
+    TEXT("Fruit.Sleep.Window"),
+    0.5f,
+    TEXT("속도가 기준 이하로 이 시간(초) 동안 유지된 과일을 재움 (0 이하: 재우지 않음)"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFruitSleepLinearThreshold(
+    TEXT("Fruit.Sleep.LinearThreshold"),
+    5.0f,
+    TEXT("재울 수 있는 최대 선속도 (cm/s)"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFruitSleepAngularThreshold(
+    TEXT("Fruit.Sleep.AngularThreshold"),
+    10.0f,
+    TEXT("재울 수 있는 최대 각속도 (도/s)"),
+    ECVF_Default);
+
+UFruitRegistrySubsystem::UFruitRegistrySubsystem()
+    : SpatialHash(AFruitBall::CalculateBallSize(AFruitBall::MaxBallType))
+{
+}
+
+bool UFruitRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UFruitRegistrySubsystem::IsPerFruitFallTickEnabled()
+{
+    return CVarFruitFallPerFruitTick.GetValueOnGameThread() != 0;
+}
+
+void UFruitRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // 물리 결과가 반영된 위치로 추락 판정
+    FallTickFunction.Setup(&InWorld, TG_PostPhysics,
+        [this](float DeltaTime)
+        {
+            SweepFallenFruits();
+            UpdateSleepStates(DeltaTime);
+        },
+        TEXT("FruitFallSweep"));
+}
+
+void UFruitRegistrySubsystem::Deinitialize()
+{
+    FallTickFunction.Teardown();
+
+    // 남아 있는 과일의 인덱스 정리
+    for (AFruitBall* Fruit : Fruits)
+    {
+        if (Fruit)
+        {
+            Fruit->RegistryIndex = INDEX_NONE;
+        }
+    }
+
+    DEC_DWORD_STAT_BY(STAT_FruitRegistered, Fruits.Num());
+
+    Fruits.Empty();
+    Positions.Empty();
+    SpatialHash.Reset();
+    PileSpheres.Reset();
+
+    Super::Deinitialize();
+}
+
+void UFruitRegistrySubsystem::RegisterFruit(AFruitBall* Fruit)
+{
+    if (!Fruit || Fruit->RegistryIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    Fruit->RegistryIndex = Fruits.Add(Fruit);
+    bSpatialHashDirty = true;
+
+    INC_DWORD_STAT(STAT_FruitRegistered);
+}
+
+void UFruitRegistrySubsystem::UnregisterFruit(AFruitBall* Fruit)
+{
+    if (!Fruit || !Fruits.IsValidIndex(Fruit->RegistryIndex) || Fruits[Fruit->RegistryIndex] != Fruit)
+    {
+        return;
+    }
+
+    // 마지막 과일을 빈 자리로 옮겨 O(1) 제거
+    const int32 RemovedIndex = Fruit->RegistryIndex;
+    Fruits.RemoveAtSwap(RemovedIndex, 1, EAllowShrinking::No);
+    if (Fruits.IsValidIndex(RemovedIndex) && Fruits[RemovedIndex])
+    {
+        Fruits[RemovedIndex]->RegistryIndex = RemovedIndex;
+    }
+
+    Fruit->RegistryIndex = INDEX_NONE;
+    bSpatialHashDirty = true;
+
+    DEC_DWORD_STAT(STAT_FruitRegistered);
+}
+
+void UFruitRegistrySubsystem::RefreshSpatialHash()
+{
+    // 같은 프레임에 연속으로 들어오는 병합은 한 번 구성한 해시를 공유
+    if (!bSpatialHashDirty && LastRefreshFrame == GFrameCounter)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_FruitSpatialHashBuild);
+
+    Positions.SetNumUninitialized(Fruits.Num(), EAllowShrinking::No);
+    ValidPositions.Init(false, Fruits.Num());
+    for (int32 Index = 0; Index < Fruits.Num(); Index++)
+    {
+        AFruitBall* Fruit = Fruits[Index];
+        const bool bValid = IsValid(Fruit);
+        Positions[Index] = bValid ? Fruit->GetActorLocation() : FVector::ZeroVector;
+        ValidPositions[Index] = bValid;
+    }
+
+    SpatialHash.Build(Positions, &ValidPositions);
+
+    LastRefreshFrame = GFrameCounter;
+    bSpatialHashDirty = false;
+}
+
+void UFruitRegistrySubsystem::GetFruitsInRadius(const FVector& Center, float Radius, TArray<AFruitBall*>& OutFruits)
+{
+    RefreshSpatialHash();
+
+    QueryScratch.Reset();
+    SpatialHash.QueryRadius(Center, Radius, Positions, QueryScratch);
+
+    OutFruits.Reserve(OutFruits.Num() + QueryScratch.Num());
+    for (int32 Index : QueryScratch)
+    {
+        AFruitBall* Fruit = Fruits[Index];
+        if (IsValid(Fruit))
+        {
+            OutFruits.Add(Fruit);
+        }
+    }
+}
+
+const FFruitPileSphereSet& UFruitRegistrySubsystem::GetPileSphereSet()
+{
+    if (LastPileFrame == GFrameCounter)
+    {
+        return PileSpheres;
+    }
+
+    // 한 번이라도 부딪힌 과일만 더미로 봄 (미리보기 공, 날아가는 공, 병합 중인 공 제외)
+    PileSpheres.Reset();
+    for (const AFruitBall* Fruit : Fruits)
+    {
+        if (IsValid(Fruit) && Fruit->IsFallCandidate())
+        {
+            PileSpheres.Add(Fruit->GetActorLocation(), AFruitBall::CalculateBallSize(Fruit->GetBallType()) * 0.5f);
+        }
+    }
+    PileSpheres.Build();
+
+    LastPileFrame = GFrameCounter;
+    return PileSpheres;
+}
+
+void UFruitRegistrySubsystem::SweepFallenFruits()
+{
+    if (IsPerFruitFallTickEnabled())
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_FruitFallSweep);
+
+    const int32 NumFruits = Fruits.Num();
+    const int32 NumPadded = Align(NumFruits, 4);
+    SET_DWORD_STAT(STAT_FruitFallSwept, NumFruits);
+
+    // 1) 대상 과일 높이를 연속 배열로 수집 (대상이 아니면 절대 걸리지 않는 값)
+    FallHeights.SetNumUninitialized(NumPadded, EAllowShrinking::No);
+    for (int32 Index = 0; Index < NumFruits; Index++)
+    {
+        const AFruitBall* Fruit = Fruits[Index];
+        FallHeights[Index] = (IsValid(Fruit) && Fruit->IsFallCandidate()) ? float(Fruit->GetActorLocation().Z) : BIG_NUMBER;
+    }
+    for (int32 Index = NumFruits; Index < NumPadded; Index++)
+    {
+        FallHeights[Index] = BIG_NUMBER;
+    }
+
+    // 2) 4개씩 FallThreshold와 비교
+    FallenScratch.Reset();
+    const VectorRegister4Float Threshold = VectorSetFloat1(AFruitBall::FallThreshold);
+    for (int32 Base = 0; Base < NumPadded; Base += 4)
+    {
+        int32 Mask = VectorMaskBits(VectorCompareLT(VectorLoadAligned(&FallHeights[Base]), Threshold));
+        while (Mask)
+        {
+            FallenScratch.Add(Fruits[Base + FMath::CountTrailingZeros(Mask)]);
+            Mask &= Mask - 1;
+        }
+    }
+
+    // 3) 추락 처리 (미리보기 공 반납 등으로 Fruits가 바뀔 수 있어 수집 후 처리)
+    for (AFruitBall* Fruit : FallenScratch)
+    {
+        if (IsValid(Fruit))
+        {
+            Fruit->BeginFallSequence();
+        }
+    }
+}
+
+void UFruitRegistrySubsystem::UpdateSleepStates(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_FruitSleepUpdate);
+
+    const float SleepWindow = CVarFruitSleepWindow.GetValueOnGameThread();
+    const float LinearThresholdSquared = FMath::Square(CVarFruitSleepLinearThreshold.GetValueOnGameThread());
+    const float AngularThresholdSquared = FMath::Square(CVarFruitSleepAngularThreshold.GetValueOnGameThread());
+
+    int32 NumAwake = 0;
+    for (AFruitBall* Fruit : Fruits)
+    {
+        UStaticMeshComponent* MeshComp = IsValid(Fruit) ? Fruit->GetMeshComponent() : nullptr;
+        if (!MeshComp || !MeshComp->IsSimulatingPhysics() || !MeshComp->RigidBodyIsAwake())
+        {
+            continue;
+        }
+
+        NumAwake++;
+
+        // 병합 중이거나 아직 아무것과도 닿지 않은(날아가는) 과일은 재우지 않음
+        if (SleepWindow <= 0.0f || Fruit->IsMerging() || !Fruit->HasCollidedBefore())
+        {
+            Fruit->SettleTime = 0.0f;
+            continue;
+        }
+
+        const bool bSettled =
+            MeshComp->GetPhysicsLinearVelocity().SizeSquared() <= LinearThresholdSquared &&
+            MeshComp->GetPhysicsAngularVelocityInDegrees().SizeSquared() <= AngularThresholdSquared;
+
+        Fruit->SettleTime = bSettled ? Fruit->SettleTime + DeltaTime : 0.0f;
+        if (Fruit->SettleTime >= SleepWindow)
+        {
+            MeshComp->PutRigidBodyToSleep();
+            Fruit->SettleTime = 0.0f;
+            NumAwake--;
+            INC_DWORD_STAT(STAT_FruitPutToSleep);
+        }
+    }
+
+    SET_DWORD_STAT(STAT_FruitAwakeBodies, NumAwake);
+}
+
+void UFruitRegistrySubsystem::WakeFruitsInRadius(const FVector& Center, float Radius)
+{
+    WakeScratch.Reset();
+    GetFruitsInRadius(Center, Radius, WakeScratch);
+
+    for (AFruitBall* Fruit : WakeScratch)
+    {
+        UStaticMeshComponent* MeshComp = Fruit->GetMeshComponent();
+        if (MeshComp && MeshComp->IsSimulatingPhysics() && !MeshComp->RigidBodyIsAwake())
+        {
+            MeshComp->WakeRigidBody();
+            Fruit->SettleTime = 0.0f;
+            INC_DWORD_STAT(STAT_FruitWoken);
+        }
+    }
+}
+
+// 안정화 비용 벤치마크 - 더미 크기별로 "병합마다 전체 순회"와 "공간 해시 반경 질의"를 비교
+// 사용법: Fruit.Bench.Stabilize [프레임당 병합 수]
+static void RunStabilizeBenchmark(const TArray<FString>& Args)
+{
+    const int32 MergesPerFrame = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 12;
+    const int32 Iterations = 200;
+    const int32 PileSizes[] = { 50, 100, 200, 400, 800 };
+
+    const float PlateRadius = 100.0f;
+    const float MaxBallSize = AFruitBall::CalculateBallSize(AFruitBall::MaxBallType);
+    const float ImpulseRadius = AFruitBall::CalculateBallSize(AFruitBall::RandomBallTypeMax) * 3.0f;
+
+    FRandomStream Random(1234);
+    FFruitSpatialHash Hash(MaxBallSize);
+    TArray<FVector> Positions;
+    TArray<FVector> MergePoints;
+    TArray<int32> Found;
+
+    for (int32 PileSize : PileSizes)
+    {
+        // 접시 위에 원기둥 형태로 쌓인 더미 생성 (높이는 과일 수에 비례)
+        const float PileHeight = FMath::Max(30.0f, PileSize * 0.5f);
+        Positions.Reset();
+        for (int32 i = 0; i < PileSize; i++)
+        {
+            const float Theta = Random.FRand() * UE_TWO_PI;
+            const float Dist = PlateRadius * FMath::Sqrt(Random.FRand());
+            Positions.Add(FVector(Dist * FMath::Cos(Theta), Dist * FMath::Sin(Theta), 30.0f + Random.FRand() * PileHeight));
+        }
+
+        MergePoints.Reset();
+        for (int32 i = 0; i < MergesPerFrame; i++)
+        {
+            MergePoints.Add(Positions[Random.RandHelper(PileSize)]);
+        }
+
+        // 1) 기존 방식: 병합마다 전체 과일을 순회하며 모두 감속
+        int64 BruteTouched = 0;
+        float Sink = 0.0f;
+        const double BruteStart = FPlatformTime::Seconds();
+        for (int32 Iter = 0; Iter < Iterations; Iter++)
+        {
+            for (int32 Merge = 0; Merge < MergePoints.Num(); Merge++)
+            {
+                for (const FVector& Position : Positions)
+                {
+                    Sink += Position.Z * 0.95f;
+                    BruteTouched++;
+                }
+            }
+        }
+        const double BruteMs = (FPlatformTime::Seconds() - BruteStart) * 1000.0 / Iterations;
+
+        // 2) 레지스트리 방식: 프레임당 한 번 해시 구성, 병합마다 반경 질의
+        int64 HashTouched = 0;
+        const double HashStart = FPlatformTime::Seconds();
+        for (int32 Iter = 0; Iter < Iterations; Iter++)
+        {
+            Hash.Build(Positions);
+            for (const FVector& MergePoint : MergePoints)
+            {
+                Found.Reset();
+                Hash.QueryRadius(MergePoint, ImpulseRadius, Positions, Found);
+                for (int32 Index : Found)
+                {
+                    Sink += Positions[Index].Z * 0.95f;
+                }
+                HashTouched += Found.Num();
+            }
+        }
+        const double HashMs = (FPlatformTime::Seconds() - HashStart) * 1000.0 / Iterations;
+
+        // Sink는 최적화로 루프가 제거되지 않도록 체크섬으로 출력
+        UE_LOG(LogTemp, Display, TEXT("[Fruit.Bench.Stabilize] 과일 %4d개, 병합 %d회/프레임: 전체 순회 %.4f ms (과일 %lld개 처리) | 공간 해시 %.4f ms (과일 %lld개 처리) (checksum %.1f)"),
+            PileSize, MergesPerFrame,
+            BruteMs, BruteTouched / Iterations,
+            HashMs, HashTouched / Iterations, Sink);
+    }
+}
+
+static FAutoConsoleCommand StabilizeBenchmarkCommand(
+    TEXT("Fruit.Bench.Stabilize"),
+    TEXT("더미 크기별 병합 안정화 비용 측정 (전체 순회 vs 공간 해시). 인자: [프레임당 병합 수]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunStabilizeBenchmark));
\ No newline at end of file
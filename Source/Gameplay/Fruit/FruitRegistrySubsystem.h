@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FruitSpatialHash.h"
+#include "FruitPileSphereSet.h"
+#include "System/Tick/FruitTickFunction.h"
+#include "FruitRegistrySubsystem.generated.h"
+
+class AFruitBall;
+
+/**
+ * 월드에 존재하는 과일 목록과 공간 해시를 관리하는 서브시스템
+ * 과일은 BeginPlay/EndPlay에서 스스로 등록/해제하므로 GetAllActorsOfClass 없이 주변 과일을 찾을 수 있음
+ * 추락 감지도 과일별 Tick 대신 여기서 TG_PostPhysics에 한 번 처리
+ * 같은 틱에서 멈춘 과일을 재우고, 병합/충격 지점 근처 과일만 깨움
+ */
+UCLASS()
+class UE_FRUITMOUNTAIN_API UFruitRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UFruitRegistrySubsystem();
+
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    // 과일 등록/해제
+    void RegisterFruit(AFruitBall* Fruit);
+    void UnregisterFruit(AFruitBall* Fruit);
+
+    // Center에서 Radius 안에 있는 과일 수집 (공간 해시는 프레임당 한 번만 재구성)
+    void GetFruitsInRadius(const FVector& Center, float Radius, TArray<AFruitBall*>& OutFruits);
+
+    // Center에서 Radius 안의 잠든 과일 깨우기 (병합, 새 충격)
+    void WakeFruitsInRadius(const FVector& Center, float Radius);
+
+    // 착지한 과일 더미의 구 집합 (궤적 예측용, 프레임당 한 번만 재구성)
+    const FFruitPileSphereSet& GetPileSphereSet();
+
+    // 등록된 전체 과일
+    const TArray<AFruitBall*>& GetFruits() const { return Fruits; }
+
+    int32 GetNumFruits() const { return Fruits.Num(); }
+
+    // 과일별 Tick으로 추락을 감지하는 기존 방식 사용 여부 (Fruit.Fall.PerFruitTick, 비교용)
+    static bool IsPerFruitFallTickEnabled();
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // 현재 프레임 기준으로 위치 배열과 공간 해시 갱신
+    void RefreshSpatialHash();
+
+    // 추락 감지 대상 과일의 높이를 모아 FallThreshold 아래로 내려간 과일 처리
+    void SweepFallenFruits();
+
+    // 속도가 일정 시간 기준 이하로 유지된 과일 재우기
+    void UpdateSleepStates(float DeltaTime);
+
+    // 등록된 과일 (인덱스는 AFruitBall::RegistryIndex와 동기화)
+    UPROPERTY()
+    TArray<AFruitBall*> Fruits;
+
+    // 공간 해시 구성 시점의 과일 위치 (Fruits와 같은 인덱스)
+    TArray<FVector> Positions;
+
+    // 공간 해시 구성 시점에 유효했던 과일 (Fruits와 같은 인덱스, 무효 항목은 해시에 넣지 않음)
+    TBitArray<> ValidPositions;
+
+    // 과일 위치 공간 해시 (셀 크기 = 최대 과일 크기)
+    FFruitSpatialHash SpatialHash;
+
+    // 마지막으로 공간 해시를 구성한 프레임
+    uint64 LastRefreshFrame = MAX_uint64;
+
+    // 등록/해제로 인덱스가 바뀌었는지 여부
+    bool bSpatialHashDirty = true;
+
+    // 질의 결과 인덱스 임시 버퍼 (매 질의마다 할당하지 않도록 재사용)
+    TArray<int32> QueryScratch;
+
+    // 착지한 과일 구 집합과 마지막 구성 프레임
+    FFruitPileSphereSet PileSpheres;
+    uint64 LastPileFrame = MAX_uint64;
+
+    // TG_PostPhysics 추락 감지 / 재우기 틱
+    FFruitTickFunction FallTickFunction;
+
+    // 추락 감지용 높이 (Fruits와 같은 인덱스, 4개 단위로 채움 - 대상이 아니면 BIG_NUMBER)
+    TArray<float, TAlignedHeapAllocator<16>> FallHeights;
+
+    // 주변 과일 질의 임시 버퍼 (깨우기용)
+    TArray<AFruitBall*> WakeScratch;
+
+    // 이번 프레임에 떨어진 과일 (처리 중 등록/해제로 인덱스가 바뀔 수 있어 포인터로 보관)
+    TArray<AFruitBall*> FallenScratch;
+};
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "FruitSpatialHash.h"
+
+FFruitSpatialHash::FFruitSpatialHash(float InCellSize)
+{
+    SetCellSize(InCellSize);
+}
+
+void FFruitSpatialHash::SetCellSize(float InCellSize)
+{
+    CellSize = FMath::Max(InCellSize, 1.0f);
+    InvCellSize = 1.0f / CellSize;
+}
+
+FIntVector FFruitSpatialHash::ToCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X * InvCellSize),
+        FMath::FloorToInt(Location.Y * InvCellSize),
+        FMath::FloorToInt(Location.Z * InvCellSize)
+    );
+}
+
+void FFruitSpatialHash::Build(TConstArrayView<FVector> Positions, const TBitArray<>* ValidMask)
+{
+    check(!ValidMask || ValidMask->Num() == Positions.Num());
+
+    // 할당된 메모리는 재사용하고 내용만 비움
+    CellHeads.Reset();
+    NextInCell.SetNumUninitialized(Positions.Num(), EAllowShrinking::No);
+
+    for (int32 Index = 0; Index < Positions.Num(); Index++)
+    {
+        if (ValidMask && !(*ValidMask)[Index])
+        {
+            NextInCell[Index] = INDEX_NONE;
+            continue;
+        }
+
+        int32& Head = CellHeads.FindOrAdd(ToCell(Positions[Index]), INDEX_NONE);
+        NextInCell[Index] = Head;
+        Head = Index;
+    }
+}
+
+void FFruitSpatialHash::QueryRadius(const FVector& Center, float Radius, TConstArrayView<FVector> Positions, TArray<int32>& OutIndices) const
+{
+    if (CellHeads.Num() == 0 || Radius <= 0.0f)
+    {
+        return;
+    }
+
+    const FIntVector MinCell = ToCell(Center - FVector(Radius));
+    const FIntVector MaxCell = ToCell(Center + FVector(Radius));
+    const float RadiusSquared = Radius * Radius;
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+        {
+            for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+            {
+                const int32* Head = CellHeads.Find(FIntVector(X, Y, Z));
+                if (!Head) continue;
+
+                for (int32 Index = *Head; Index != INDEX_NONE; Index = NextInCell[Index])
+                {
+                    if (FVector::DistSquared(Positions[Index], Center) <= RadiusSquared)
+                    {
+                        OutIndices.Add(Index);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void FFruitSpatialHash::Reset()
+{
+    CellHeads.Reset();
+    NextInCell.Reset();
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 과일 위치를 균일 격자로 나눠 담는 공간 해시
+ * 셀 크기를 가장 큰 과일 지름에 맞추면 반경 질의 시 주변 셀 몇 개만 확인하면 됨
+ */
+struct UE_FRUITMOUNTAIN_API FFruitSpatialHash
+{
+    explicit FFruitSpatialHash(float InCellSize = 45.f);
+
+    // 셀 크기 변경 (다음 Build부터 적용)
+    void SetCellSize(float InCellSize);
+
+    float GetCellSize() const { return CellSize; }
+
+    // 위치 배열로 격자 재구성 - 항목 인덱스는 Positions 인덱스와 동일
+    // ValidMask가 있으면 false인 항목은 격자에 넣지 않음 (질의에도 나오지 않음)
+    void Build(TConstArrayView<FVector> Positions, const TBitArray<>* ValidMask = nullptr);
+
+    // Center에서 Radius 안에 중심이 있는 항목 인덱스를 OutIndices에 추가
+    void QueryRadius(const FVector& Center, float Radius, TConstArrayView<FVector> Positions, TArray<int32>& OutIndices) const;
+
+    // 격자 비우기 (메모리는 유지)
+    void Reset();
+
+private:
+    FIntVector ToCell(const FVector& Location) const;
+
+    float CellSize;
+    float InvCellSize;
+
+    // 셀 좌표 -> 셀의 첫 항목 인덱스
+    TMap<FIntVector, int32> CellHeads;
+
+    // 같은 셀의 다음 항목 인덱스 (INDEX_NONE이면 끝)
+    TArray<int32> NextInCell;
+};
\ No newline at end of file
@@ -25,6 +25,10 @@ public:
     UFUNCTION(BlueprintCallable, Category="FruitSpawn")
     static class AActor* SpawnBall(class AFruitPlayerController* Controller, const FVector& Location, int32 BallType, bool bEnablePhysics);
     
+    // 공 반납 함수 - 과일 풀에 돌려주고, 풀이 없거나 과일이 아니면 제거
+    UFUNCTION(BlueprintCallable, Category="FruitSpawn")
+    static void ReleaseBall(class AActor* Ball);
+    
     // 접시 가장자리 위치 계산 함수
     UFUNCTION(BlueprintCallable, Category="FruitSpawn")
     static FVector CalculatePlateEdgeSpawnPosition(class UWorld* World, float CameraAngle = 0.f);
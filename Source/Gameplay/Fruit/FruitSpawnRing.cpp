@@ -0,0 +1,59 @@
+#include "FruitSpawnRing.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Spawn Ring Build"), STAT_FruitSpawnRingBuild, STATGROUP_FruitMountain);
+
+FVector FFruitSpawnRing::EvaluateExact(const FVector& Center, float RimRadius, float BaseHeight, float CameraAngle, float HeightOffset)
+{
+    // 카메라 방향 벡터 계산
+    const float RadianAngle = FMath::DegreesToRadians(CameraAngle);
+    const FVector CameraDirection(FMath::Cos(RadianAngle), FMath::Sin(RadianAngle), 0.0f);
+
+    // 카메라 방향의 반대쪽 접시 가장자리 지점 계산 (카메라에서 가장 먼 곳)
+    FVector EdgePoint = Center + CameraDirection * RimRadius;
+
+    // 높이 조정 - 전체 구조물(테이블+접시) 위로, 공 크기를 고려한 오프셋 적용
+    EdgePoint.Z = BaseHeight + HeightOffset;
+    return EdgePoint;
+}
+
+void FFruitSpawnRing::Build(const FVector& InCenter, float RimRadius, float InBaseHeight)
+{
+    SCOPE_CYCLE_COUNTER(STAT_FruitSpawnRingBuild);
+
+    RimPoints.SetNumUninitialized(NumSegments + 1);
+    for (int32 Index = 0; Index <= NumSegments; Index++)
+    {
+        const float Angle = Index * (360.0f / NumSegments);
+        RimPoints[Index] = EvaluateExact(InCenter, RimRadius, InBaseHeight, Angle, 0.0f);
+    }
+}
+
+void FFruitSpawnRing::FindSegment(float CameraAngle, int32& OutIndex, float& OutAlpha) const
+{
+    float Wrapped = FMath::Fmod(CameraAngle, 360.0f);
+    if (Wrapped < 0.0f)
+    {
+        Wrapped += 360.0f;
+    }
+
+    const float Position = Wrapped * (NumSegments / 360.0f);
+    OutIndex = FMath::Min(FMath::FloorToInt(Position), NumSegments - 1);
+    OutAlpha = Position - OutIndex;
+}
+
+FVector FFruitSpawnRing::GetSpawnLocation(float CameraAngle) const
+{
+    if (!IsValid())
+    {
+        return FVector::ZeroVector;
+    }
+
+    int32 Index = 0;
+    float Alpha = 0.0f;
+    FindSegment(CameraAngle, Index, Alpha);
+
+    FVector Location = FMath::Lerp(RimPoints[Index], RimPoints[Index + 1], Alpha);
+    Location.Z += DefaultHeightOffset;
+    return Location;
+}
\ No newline at end of file
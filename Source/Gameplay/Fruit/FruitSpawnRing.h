@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 접시 가장자리 스폰 위치 테이블 - 접시 모양(FFruitPlateGeometry)을 만들 때 한 번 구성
+ * 카메라 각도 1도 간격으로 가장자리 점을 저장하고
+ * 조회는 인접한 두 점 보간만 함 (Cos/Sin, 반지름 계산, 월드 접근 없음)
+ */
+class UE_FRUITMOUNTAIN_API FFruitSpawnRing
+{
+public:
+    // 링 해상도 (360 / NumSegments 도 간격)
+    static constexpr int32 NumSegments = 360;
+
+    // 전체 구조물(테이블+접시) 위 스폰 높이 여유 (공 크기 고려)
+    static constexpr float DefaultHeightOffset = 7.5f;
+
+    // 카메라 방향 쪽 가장자리 스폰 위치 직접 계산 (링 구성과 테스트용)
+    static FVector EvaluateExact(const FVector& Center, float RimRadius, float BaseHeight, float CameraAngle, float HeightOffset = DefaultHeightOffset);
+
+    // 접시 중심, 순수 접시 반지름, 전체 구조물 윗면 높이로 링 구성
+    void Build(const FVector& InCenter, float RimRadius, float InBaseHeight);
+
+    bool IsValid() const { return RimPoints.Num() == NumSegments + 1; }
+
+    // 카메라 각도의 스폰 위치
+    FVector GetSpawnLocation(float CameraAngle) const;
+
+private:
+    // 카메라 각도 -> 세그먼트 인덱스와 보간 비율
+    void FindSegment(float CameraAngle, int32& OutIndex, float& OutAlpha) const;
+
+    // 가장자리 점 (Z = 전체 구조물 윗면) - 마지막 점은 첫 점과 같아 감싸기 분기 없이 보간
+    TArray<FVector> RimPoints;
+};
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "FruitTypeCatalog.h"
+#include "Engine/StaticMesh.h"
+
+FFruitTypeTableRow FFruitTypeTable::Rows[AFruitBall::MaxBallType + 1];
+bool FFruitTypeTable::bBaked = false;
+
+UFruitTypeCatalog::UFruitTypeCatalog()
+{
+    Types.SetNum(AFruitBall::MaxBallType);
+    for (int32 BallType = 1; BallType <= AFruitBall::MaxBallType; BallType++)
+    {
+        Types[BallType - 1] = MakeDefaultDefinition(BallType);
+    }
+}
+
+FFruitTypeDefinition UFruitTypeCatalog::MakeDefaultDefinition(int32 BallType)
+{
+    FFruitTypeDefinition Definition;
+
+    // 과일 레벨에 따른 크기 선형 상수 증가 (레벨 1: 15cm, 레벨 2: 18cm, ...)
+    Definition.Size = AFruitBall::BaseBallSize + ((BallType - 1) * AFruitBall::BaseBallSize * 0.2f);
+
+    // 과일 레벨에 따른 질량 지수 증가 (레벨 1: 100kg, 레벨 2: 102.5kg, ...)
+    Definition.Mass = AFruitBall::DensityFactor * FMath::Pow(1.025f, BallType - 1);
+
+    Definition.SizeFactor = FMath::Min(2.0f, 0.5f + (BallType * 0.2f));
+
+    // 등차수열의 합 공식: n*(n+1)/2
+    Definition.BaseScore = (BallType * (BallType + 1)) / 2;
+
+    Definition.Mesh = TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(
+        FString::Printf(TEXT("/Game/Fruit/Meshes/Fruit%d.Fruit%d"), BallType, BallType)));
+
+    // 이펙트 크기는 고정, 레벨이 높을수록 큰 소리, 높은 소리
+    Definition.EffectScale = 1.0f;
+    Definition.SoundVolume = 1.0f + (BallType * 0.1f);
+    Definition.SoundPitch = 0.8f + (BallType * 0.05f);
+
+    return Definition;
+}
+
+void FFruitTypeTable::Bake(const UFruitTypeCatalog* Catalog)
+{
+    check(IsInGameThread());
+
+    for (int32 BallType = 1; BallType <= AFruitBall::MaxBallType; BallType++)
+    {
+        const FFruitTypeDefinition Definition = (Catalog && Catalog->Types.IsValidIndex(BallType - 1))
+            ? Catalog->Types[BallType - 1]
+            : UFruitTypeCatalog::MakeDefaultDefinition(BallType);
+
+        FFruitTypeTableRow& Row = Rows[BallType];
+        Row.Size = Definition.Size;
+        Row.Scale = Definition.Size / 100.0f;
+        Row.Mass = Definition.Mass;
+        Row.SizeFactor = Definition.SizeFactor;
+        Row.SettledDamping = 2.0f * Definition.SizeFactor;
+        Row.BaseScore = Definition.BaseScore;
+        Row.EffectScale = Definition.EffectScale;
+        Row.SoundVolume = Definition.SoundVolume;
+        Row.SoundPitch = Definition.SoundPitch;
+    }
+
+    // 0번은 사용하지 않지만 잘못된 조회에 대비해 1번과 같게 유지
+    Rows[0] = Rows[1];
+    bBaked = true;
+}
+
+void FFruitTypeTable::SetMesh(int32 BallType, UStaticMesh* Mesh)
+{
+    check(IsInGameThread());
+
+    if (BallType >= 1 && BallType <= AFruitBall::MaxBallType)
+    {
+        Rows[BallType].Mesh = Mesh;
+    }
+}
\ No newline at end of file
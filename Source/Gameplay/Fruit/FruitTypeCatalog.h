@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Actors/FruitBall.h"
+#include "FruitTypeCatalog.generated.h"
+
+class UStaticMesh;
+
+// 과일 타입 하나의 설정 (에디터에서 수정하는 원본 값)
+USTRUCT(BlueprintType)
+struct FFruitTypeDefinition
+{
+    GENERATED_BODY()
+
+    // 지름 (월드 단위 cm)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Fruit")
+    float Size = 15.0f;
+
+    // 질량 (kg)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Fruit")
+    float Mass = 100.0f;
+
+    // 안정화 시 감속/감쇠 배율
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Fruit")
+    float SizeFactor = 0.7f;
+
+    // 병합 기본 점수
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Fruit")
+    int32 BaseScore = 1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Fruit")
+    TSoftObjectPtr<UStaticMesh> Mesh;
+
+    // 병합 이펙트 크기, 사운드 볼륨/피치
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Effect")
+    float EffectScale = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Effect")
+    float SoundVolume = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Effect")
+    float SoundPitch = 1.0f;
+};
+
+/**
+ * 과일 타입 1..MaxBallType 설정을 담는 데이터 에셋
+ * 기본값은 기존 계산식(크기 선형 증가, 질량 지수 증가 등)으로 채워짐
+ */
+UCLASS(BlueprintType)
+class UE_FRUITMOUNTAIN_API UFruitTypeCatalog : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UFruitTypeCatalog();
+
+    // 인덱스 0 = BallType 1
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, EditFixedSize, Category="Fruit")
+    TArray<FFruitTypeDefinition> Types;
+
+    // 기존 계산식으로 만든 기본 설정
+    static FFruitTypeDefinition MakeDefaultDefinition(int32 BallType);
+};
+
+// 게임 중 조회용으로 구운 과일 타입 값 (한 줄에 한 타입, 계산/문자열 생성 없이 바로 사용)
+struct FFruitTypeTableRow
+{
+    float Size = 0.0f;
+    float Scale = 0.0f;
+    float Mass = 0.0f;
+    float SizeFactor = 0.0f;
+    float SettledDamping = 0.0f;
+    int32 BaseScore = 0;
+
+    // UFruitAssetSubsystem의 로드 핸들이 유지하는 메시 (로드 전이나 모든 게임 인스턴스가 핸들을 놓은 뒤에는 nullptr)
+    TWeakObjectPtr<UStaticMesh> Mesh;
+
+    float EffectScale = 1.0f;
+    float SoundVolume = 1.0f;
+    float SoundPitch = 1.0f;
+};
+
+/**
+ * 과일 타입별 값을 BallType으로 바로 찾는 평면 테이블
+ * 모듈 시작 시 게임 스레드에서 카탈로그 기본값으로 구워지고, 카탈로그 에셋이 로드되면 다시 구워짐
+ * 조회는 잠금 없이 하므로 굽기/메시 연결은 게임 스레드에서만 함
+ */
+struct UE_FRUITMOUNTAIN_API FFruitTypeTable
+{
+    // BallType 범위를 벗어나면 가장 가까운 타입 반환
+    static const FFruitTypeTableRow& Get(int32 BallType)
+    {
+        checkSlow(bBaked);
+        return Rows[FMath::Clamp(BallType, 1, AFruitBall::MaxBallType)];
+    }
+
+    // 카탈로그 값으로 테이블 구성 (nullptr이면 기본값)
+    static void Bake(const UFruitTypeCatalog* Catalog);
+
+    // 비동기 로드된 메시 연결
+    static void SetMesh(int32 BallType, UStaticMesh* Mesh);
+
+private:
+    static FFruitTypeTableRow Rows[AFruitBall::MaxBallType + 1];
+    static bool bBaked;
+};
\ No newline at end of file
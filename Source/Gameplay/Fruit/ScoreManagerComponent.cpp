@@ -1,6 +1,7 @@
 #include "ScoreManagerComponent.h"
 #include "Framework/UE_FruitMountainGameMode.h"
 #include "Kismet/GameplayStatics.h"
+#include "FruitTypeCatalog.h"
 
 UScoreManagerComponent::UScoreManagerComponent()
 {
@@ -111,8 +112,8 @@ void UScoreManagerComponent::ExtendComboTime()
 
 int32 UScoreManagerComponent::CalculateBaseScore(int32 BallType) const
 {
-    // 등차수열의 합 공식: n*(n+1)/2
-    return (BallType * (BallType + 1)) / 2;
+    // 과일 타입 테이블에서 조회 (기본값: n*(n+1)/2)
+    return FFruitTypeTable::Get(BallType).BaseScore;
 }
 
 float UScoreManagerComponent::CalculateComboMultiplier() const
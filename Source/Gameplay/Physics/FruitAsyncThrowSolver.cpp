@@ -0,0 +1,118 @@
+#include "FruitAsyncThrowSolver.h"
+#include "FruitTrajectoryHelper.h"
+#include "Misc/ScopeLock.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Throw Solver Job"), STAT_FruitThrowSolverJob, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throw Solver Requested"), STAT_FruitThrowSolverRequested, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throw Solver Cancelled"), STAT_FruitThrowSolverCancelled, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throw Solver Published"), STAT_FruitThrowSolverPublished, STATGROUP_FruitMountain);
+
+void FFruitAsyncThrowSolver::Solve(const FFruitThrowQuery& Query, FFruitLocalThrow& OutThrow)
+{
+    OutThrow.Physics = UFruitPhysicsHelper::SolveThrow(
+        Query.Scene, Query.StartLocation, Query.TargetLocation, Query.ThrowAngle, Query.BallMass);
+
+    UFruitTrajectoryHelper::CalculateAnalyticTrajectoryPoints(
+        Query.Scene.PlateDisc, Query.StartLocation, OutThrow.Physics.LaunchVelocity, -Query.Scene.Gravity, OutThrow.TrajectoryPoints);
+
+    // 위치는 기준점 기준으로 저장
+    OutThrow.StartLocation = Query.StartLocation - Query.Origin;
+    OutThrow.Physics.AdjustedTarget -= Query.Origin;
+    for (FVector& Point : OutThrow.TrajectoryPoints)
+    {
+        Point -= Query.Origin;
+    }
+}
+
+void FFruitAsyncThrowSolver::Request(const FFruitThrowQuery& Query)
+{
+    check(IsInGameThread());
+
+    if (IsPending(Query.Key))
+    {
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_FruitThrowSolverRequested);
+
+    const uint32 Sequence = ++LatestSequence;
+    PendingKey = Query.Key;
+    bHasPending = true;
+
+    TSharedRef<FFruitAsyncThrowSolver, ESPMode::ThreadSafe> Self = AsShared();
+    auto Job = [Self, Query, Sequence]()
+    {
+        // 시작 전에 더 새로운 요청이 있으면 건너뜀
+        if (Self->LatestSequence.load() != Sequence)
+        {
+            INC_DWORD_STAT(STAT_FruitThrowSolverCancelled);
+            return;
+        }
+
+        {
+            SCOPE_CYCLE_COUNTER(STAT_FruitThrowSolverJob);
+            Solve(Query, Self->BackBuffer);
+        }
+
+        // 계산 중에 새 요청이 들어왔으면 게시하지 않음
+        if (Self->LatestSequence.load() != Sequence)
+        {
+            INC_DWORD_STAT(STAT_FruitThrowSolverCancelled);
+            return;
+        }
+
+        FScopeLock Lock(&Self->FrontLock);
+        Swap(Self->BackBuffer, Self->FrontBuffer);
+        Self->FrontKey = Query.Key;
+        Self->FrontGeneration = Query.Generation;
+        Self->bFrontReady = true;
+        INC_DWORD_STAT(STAT_FruitThrowSolverPublished);
+    };
+
+    // 뒤 버퍼를 쓰는 작업이 하나뿐이도록 이전 작업 뒤에 이어서 실행
+    if (LastTask.IsValid())
+    {
+        LastTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Job), UE::Tasks::Prerequisites(LastTask));
+    }
+    else
+    {
+        LastTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Job));
+    }
+}
+
+bool FFruitAsyncThrowSolver::TryConsume(uint32& OutKey, uint32& OutGeneration, FFruitLocalThrow& OutThrow)
+{
+    check(IsInGameThread());
+
+    // 워커가 교체 중이면 다음 프레임에 다시 확인
+    if (!FrontLock.TryLock())
+    {
+        return false;
+    }
+
+    const bool bReady = bFrontReady;
+    if (bReady)
+    {
+        OutKey = FrontKey;
+        OutGeneration = FrontGeneration;
+        OutThrow = MoveTemp(FrontBuffer);
+        bFrontReady = false;
+    }
+
+    FrontLock.Unlock();
+
+    if (bReady && bHasPending && PendingKey == OutKey)
+    {
+        bHasPending = false;
+    }
+    return bReady;
+}
+
+void FFruitAsyncThrowSolver::Cancel()
+{
+    check(IsInGameThread());
+
+    ++LatestSequence;
+    bHasPending = false;
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+#include "FruitThrowSolution.h"
+#include <atomic>
+
+// 워커 스레드에서 계산할 던지기 요청 - 씬 정보는 게임 스레드에서 미리 모아 둠
+struct FFruitThrowQuery
+{
+    // 접시 기준 캐시 키 (FFruitThrowSolutionCache::MakeKey)
+    uint32 Key = 0;
+
+    // 요청 시점의 접시 캐시 세대 (접시가 바뀐 뒤 도착한 결과는 버림)
+    uint32 Generation = 0;
+
+    FFruitThrowScene Scene;
+
+    // 카메라 각도 0의 스폰 위치 (월드)
+    FVector StartLocation = FVector::ZeroVector;
+
+    FVector TargetLocation = FVector::ZeroVector;
+
+    // 결과 위치를 저장할 기준점 (회전 중심)
+    FVector Origin = FVector::ZeroVector;
+
+    float ThrowAngle = 0.0f;
+    float BallMass = 0.0f;
+};
+
+/**
+ * 던지기 해를 UE::Tasks 작업으로 계산하는 비동기 솔버
+ * 작업은 이전 작업 뒤에 이어서 실행되고, 더 새로운 요청이 들어오면 시작 전/계산 후에 결과를 버림
+ * 워커는 뒤 버퍼에 쓰고 짧은 잠금으로 앞 버퍼와 교체, 게임 스레드는 TryLock으로만 읽어 대기하지 않음
+ */
+class FFruitAsyncThrowSolver : public TSharedFromThis<FFruitAsyncThrowSolver, ESPMode::ThreadSafe>
+{
+public:
+    // 월드 없이 던지기 해 계산 (물리 + 해석적 궤적) - 동기 경로에서도 같은 함수 사용
+    static void Solve(const FFruitThrowQuery& Query, FFruitLocalThrow& OutThrow);
+
+    // 새 요청 - 진행 중인 이전 요청은 취소됨 (같은 키가 이미 진행 중이면 무시)
+    void Request(const FFruitThrowQuery& Query);
+
+    // 완료된 결과 가져오기 (게임 스레드, 대기 없음)
+    bool TryConsume(uint32& OutKey, uint32& OutGeneration, FFruitLocalThrow& OutThrow);
+
+    // 진행 중인 요청 취소
+    void Cancel();
+
+    // 이 키의 요청이 진행 중인지 (게임 스레드)
+    bool IsPending(uint32 Key) const { return bHasPending && PendingKey == Key; }
+
+private:
+    // 가장 최근 요청 번호 (작업은 자신의 번호가 최신일 때만 결과를 게시)
+    std::atomic<uint32> LatestSequence{0};
+
+    // 마지막으로 띄운 작업 (다음 작업의 선행 조건, 게임 스레드에서만 접근)
+    UE::Tasks::FTask LastTask;
+
+    uint32 PendingKey = 0;
+    bool bHasPending = false;
+
+    // 워커 전용 뒤 버퍼 (작업이 이어서 실행되므로 동시에 쓰는 작업은 하나)
+    FFruitLocalThrow BackBuffer;
+
+    // 게시된 앞 버퍼 (FrontLock으로 보호)
+    FCriticalSection FrontLock;
+    FFruitLocalThrow FrontBuffer;
+    uint32 FrontKey = 0;
+    uint32 FrontGeneration = 0;
+    bool bFrontReady = false;
+};
\ No newline at end of file
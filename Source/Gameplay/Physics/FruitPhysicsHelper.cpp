@@ -1,26 +1,134 @@
 #include "FruitPhysicsHelper.h"
 #include "FruitPhysicsInitializer.h"
-#include "Kismet/GameplayStatics.h"
+#include "FruitTrajectoryHelper.h"
+#include "FruitThrowCacheSubsystem.h"
 #include "PhysicsEngine/PhysicsSettings.h"
 #include "Actors/FruitBall.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Throw Solve"), STAT_FruitThrowSolve, STATGROUP_FruitMountain);
 
 // const 정적 변수 초기화
 const float UFruitPhysicsHelper::MinThrowAngle = 0.f;
 const float UFruitPhysicsHelper::MaxThrowAngle = 57.5f;
 
+// 기존 휴리스틱 던지기 계산 (배율 튜닝 + 검증 끝점 기반 보정) - 해가 없을 때 대체용
+static FThrowPhysicsResult SolveThrowLegacy(const FFruitThrowScene& Scene, const FVector& StartLocation, const FVector& TargetLocation, float ThrowAngle, float BallMass);
+
 // 통합 물리 계산 함수 구현
 FThrowPhysicsResult UFruitPhysicsHelper::CalculateThrowPhysics(UWorld* World, const FVector& StartLocation, const FVector& TargetLocation, float ThrowAngle, float BallMass)
 {
-    // 물리 데이터 초기화 데이터 구조체 생성
-    FPhysicsInitData InitData(World, StartLocation, TargetLocation, ThrowAngle, BallMass);
+    // 0. 캐싱 처리 - 월드별 LRU 캐시 (양자화한 시작/목표/각도/질량 기준)
+    UFruitThrowCacheSubsystem* ThrowCache = World ? World->GetSubsystem<UFruitThrowCacheSubsystem>() : nullptr;
+    const FFruitThrowCacheKey CacheKey = FFruitThrowCacheKey::Make(StartLocation, TargetLocation, ThrowAngle, BallMass);
     
-    // 0. 캐싱 처리 - 성능 최적화 (분리된 함수 사용)
     FThrowPhysicsResult Result;
-    if (UFruitPhysicsInitializer::CheckCachedResult(InitData, Result))
+    if (ThrowCache && ThrowCache->Find(CacheKey, Result))
     {
         return Result;
     }
     
+    // 씬 정보는 계산 전에 한 번에 수집 (계산 자체는 씬 질의 없음)
+    Result = SolveThrow(GatherThrowScene(World), StartLocation, TargetLocation, ThrowAngle, BallMass);
+    
+    // 계산 결과 캐싱
+    if (ThrowCache)
+    {
+        ThrowCache->Add(CacheKey, Result);
+    }
+    
+    return Result;
+}
+
+FFruitThrowScene UFruitPhysicsHelper::GatherThrowScene(UWorld* World)
+{
+    FFruitThrowScene Scene;
+    Scene.Gravity = FMath::Abs(GetDefault<UPhysicsSettings>()->DefaultGravityZ);
+    Scene.PlateTopHeight = UFruitPhysicsInitializer::FindPlateTopHeight(World);
+    if (World)
+    {
+        Scene.PlateDisc = UFruitTrajectoryHelper::GetPlateDisc(World);
+    }
+    return Scene;
+}
+
+FThrowPhysicsResult UFruitPhysicsHelper::SolveThrow(const FFruitThrowScene& Scene, const FVector& StartLocation, const FVector& TargetLocation, float ThrowAngle, float BallMass)
+{
+    SCOPE_CYCLE_COUNTER(STAT_FruitThrowSolve);
+    
+    const float UseAngle = FMath::Clamp(ThrowAngle, MinThrowAngle, MaxThrowAngle);
+    
+    // 1. 착지 목표 - 목표 위치 바로 위의 접시 윗면 (궤적 끝점과 같은 기준: 윗면 + 과일 반경)
+    FVector LandingTarget = TargetLocation;
+    if (Scene.PlateDisc.bValid)
+    {
+        LandingTarget.Z = Scene.PlateDisc.Center.Z + UFruitTrajectoryHelper::TrajectoryProbeRadius;
+    }
+    
+    // 2. 발사 각도를 고정하고 목표를 지나는 속력 (닫힌 해)
+    float Speed = 0.0f;
+    if (!SolveLaunchSpeed(StartLocation, LandingTarget, Scene.Gravity, UseAngle, Speed))
+    {
+        // 이 각도로는 목표에 닿을 수 없음 (목표가 시작점보다 너무 높음) - 기존 방식으로 대체
+        return SolveThrowLegacy(Scene, StartLocation, TargetLocation, ThrowAngle, BallMass);
+    }
+    
+    // 3. 결과 채우기 - 던질 때는 방향 * 속력 * 질량 충격량을 주므로 질량과 무관하게 같은 궤적
+    // 던진 과일은 선형 감쇠 0으로 날아가므로(AFruitBall::ConfigureForSpawn) 감쇠 보정 없음
+    FThrowPhysicsResult Result;
+    Result.AdjustedTarget = LandingTarget;
+    Result.LaunchDirection = MakeLaunchDirection(StartLocation, LandingTarget, UseAngle);
+    Result.InitialSpeed = Speed;
+    Result.LaunchVelocity = Result.LaunchDirection * Speed;
+    Result.AdjustedForce = BallMass * Speed;
+    Result.PeakHeight = Result.LaunchVelocity.Z > 0.0f ? FMath::Square(Result.LaunchVelocity.Z) / (2.0f * Scene.Gravity) : 0.0f;
+    Result.bSuccess = true;
+    return Result;
+}
+
+FVector UFruitPhysicsHelper::MakeLaunchDirection(const FVector& StartLocation, const FVector& TargetLocation, float ElevationDeg)
+{
+    FVector Horizontal = TargetLocation - StartLocation;
+    Horizontal.Z = 0.0f;
+    Horizontal = Horizontal.GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+    
+    float Sin = 0.0f;
+    float Cos = 1.0f;
+    FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(ElevationDeg));
+    return FVector(Horizontal.X * Cos, Horizontal.Y * Cos, Sin);
+}
+
+bool UFruitPhysicsHelper::SolveLaunchSpeed(const FVector& StartLocation, const FVector& TargetLocation, float Gravity, float ElevationDeg, float& OutSpeed)
+{
+    // 수평 거리 d, 높이 차 h, 발사 각 a 일 때 포물선이 목표를 지나는 속력
+    // v^2 = g d^2 / (2 cos^2(a) (d tan(a) - h))
+    const double Distance = FVector::Dist2D(StartLocation, TargetLocation);
+    const double Height = TargetLocation.Z - StartLocation.Z;
+    const double Angle = FMath::DegreesToRadians((double)ElevationDeg);
+    const double Cos = FMath::Cos(Angle);
+    
+    const double Denominator = 2.0 * Cos * Cos * (Distance * FMath::Tan(Angle) - Height);
+    if (Distance < UE_KINDA_SMALL_NUMBER || Denominator <= UE_DOUBLE_SMALL_NUMBER)
+    {
+        return false;
+    }
+    
+    OutSpeed = (float)FMath::Sqrt(Gravity * Distance * Distance / Denominator);
+    return true;
+}
+
+static FThrowPhysicsResult SolveThrowLegacy(const FFruitThrowScene& Scene, const FVector& StartLocation, const FVector& TargetLocation, float ThrowAngle, float BallMass)
+{
+    const float MinThrowAngle = UFruitPhysicsHelper::MinThrowAngle;
+    const float MaxThrowAngle = UFruitPhysicsHelper::MaxThrowAngle;
+    
+    // 물리 데이터 초기화 데이터 구조체 생성 (씬 정보는 미리 수집한 값 사용)
+    FPhysicsInitData InitData(nullptr, StartLocation, TargetLocation, ThrowAngle, BallMass);
+    InitData.PlateTopHeight = Scene.PlateTopHeight;
+    InitData.Gravity = Scene.Gravity;
+    
+    FThrowPhysicsResult Result;
+    
     // 1~6. 초기 물리 데이터 계산 (별도 클래스 사용)
     FPhysicsBaseResult BaseResult = UFruitPhysicsInitializer::InitializePhysics(InitData);
     
@@ -28,9 +136,6 @@ FThrowPhysicsResult UFruitPhysicsHelper::CalculateThrowPhysics(UWorld* World, co
     Result.AdjustedTarget = BaseResult.AdjustedTarget;
     Result.LaunchDirection = BaseResult.LaunchDirection;
     
-    // 현재 시간 가져오기
-    float CurrentTime = World ? World->GetTimeSeconds() : 0.0f;
-    
     // 7. 속도 계산 (아래 코드는 원래 코드 유지)
     // 7-1. 기본 속도값 설정
     float BaseSpeed = 250.0f;
@@ -101,36 +206,14 @@ FThrowPhysicsResult UFruitPhysicsHelper::CalculateThrowPhysics(UWorld* World, co
     // 14. 물리 기반 발사 속도 참조값 계산 안함
 
     // 15. 검증 과정 개선
-    // 15-1. 더 현실적인 설정으로 검증 테스트
-    FPredictProjectilePathParams ValidateParams;
-    ValidateParams.StartLocation = StartLocation;
-    ValidateParams.LaunchVelocity = Result.LaunchVelocity;
-    ValidateParams.bTraceWithCollision = true;  // 충돌 활성화
-    ValidateParams.ProjectileRadius = 5.0f;     // 과일 반경 추가
-    ValidateParams.SimFrequency = 30;           // 더 정밀한 시뮬레이션
-    ValidateParams.MaxSimTime = 3.0f;           // 3초로 제한 (접시 도달 충분)
-    ValidateParams.OverrideGravityZ = -BaseResult.Gravity;
-    ValidateParams.TraceChannel = ECC_WorldStatic;  // 월드 정적 객체와 충돌 확인
-
-    // 접시를 명시적으로 충돌 테스트에 포함
-    TArray<AActor*> PlateActors;
-    UGameplayStatics::GetAllActorsWithTag(World, FName("Plate"), PlateActors);
-    ValidateParams.ActorsToIgnore.Empty();
-
-    // 과일은 무시
-    TArray<AActor*> FruitBalls;
-    UGameplayStatics::GetAllActorsOfClass(World, AFruitBall::StaticClass(), FruitBalls);
-    ValidateParams.ActorsToIgnore = FruitBalls;
-
-    // 15-2. 검증 시뮬레이션 실행
-    FPredictProjectilePathResult ValidationResult;
-    UGameplayStatics::PredictProjectilePath(World, ValidateParams, ValidationResult);
-
-    // 15-3. 끝점 위치와 접시 중앙까지의 거리 계산 및 자동 보정
-    if (ValidationResult.PathData.Num() > 0)
+    // 15-1. 검증 끝점 계산 - 포물선과 접시 윗면의 교점 (트레이스 없음)
+    FVector EndPoint = FVector::ZeroVector;
+    float FlightTime = 0.0f;
+    UFruitTrajectoryHelper::SolveLanding(StartLocation, Result.LaunchVelocity, -Scene.Gravity,
+        Scene.PlateDisc, UFruitTrajectoryHelper::TrajectoryProbeRadius, FlightTime, EndPoint);
+
+    // 15-2. 끝점 위치와 접시 중앙까지의 거리 계산 및 자동 보정
     {
-        FVector EndPoint = ValidationResult.PathData.Last().Location;
-        
         float XYDistance = FVector::Dist(
             FVector(EndPoint.X, EndPoint.Y, 0),
             FVector(BaseResult.PlateCenter.X, BaseResult.PlateCenter.Y, 0)
@@ -210,13 +293,10 @@ FThrowPhysicsResult UFruitPhysicsHelper::CalculateThrowPhysics(UWorld* World, co
     // 16-1. 계산 성공 표시
     Result.bSuccess = true;
     
-    // 16-2. 계산 결과 캐싱 - InitializePhysics 클래스의 함수 사용
-    UFruitPhysicsInitializer::UpdateCachedResult(InitData, Result, CurrentTime);
-    
-    // 16-3. 최종 로깅
+    // 16-2. 최종 로깅
     // UE_LOG(LogTemp, Log, TEXT("물리 계산: 각도=%.1f°, 속도=%.1f, 힘=%.1f, 질량=%.1f"),
     //    BaseResult.UseAngle, Result.InitialSpeed, Result.AdjustedForce, BallMass);
     
-    // 16-4. 결과 반환
+    // 16-3. 결과 반환
     return Result;
 }
\ No newline at end of file
@@ -6,6 +6,28 @@
 
 class AFruitPlayerController;
 
+// 접시 윗면 원판 (궤적 끝점 계산용, 월드당 한 번 구함)
+struct FFruitPlateDisc
+{
+    // 윗면 중심 (Z = 윗면 높이)
+    FVector Center = FVector::ZeroVector;
+    float Radius = 0.0f;
+    bool bValid = false;
+};
+
+// 던지기 계산에 필요한 씬 정보 - 게임 스레드에서 한 번 모아 두고 월드 없이 계산할 때 전달
+struct FFruitThrowScene
+{
+    // 접시 윗면 높이 (여유 5 포함)
+    float PlateTopHeight = 0.0f;
+
+    // 중력 크기 (양수)
+    float Gravity = 980.0f;
+
+    // 착지 목표 높이 계산용 접시 원판
+    FFruitPlateDisc PlateDisc;
+};
+
 // 물리 계산 결과를 담을 구조체 추가
 USTRUCT(BlueprintType)
 struct FThrowPhysicsResult
@@ -65,4 +87,19 @@ public:
     // 통합 물리 계산 함수 (모든 물리 계산의 핵심)
     UFUNCTION(BlueprintCallable, Category = "Physics")
     static FThrowPhysicsResult CalculateThrowPhysics(UWorld* World, const FVector& StartLocation, const FVector& TargetLocation, float ThrowAngle, float BallMass);
+
+    // 던지기 계산에 필요한 씬 정보 수집 (게임 스레드)
+    static FFruitThrowScene GatherThrowScene(UWorld* World);
+
+    // 월드 없이 던지기 계산 - 발사 각도를 고정한 포물선 닫힌 해 (씬 질의 없음, 워커 스레드에서 호출 가능)
+    static FThrowPhysicsResult SolveThrow(const FFruitThrowScene& Scene, const FVector& StartLocation, const FVector& TargetLocation, float ThrowAngle, float BallMass);
+
+    // 발사 각도(도)를 고정하고 StartLocation에서 TargetLocation을 지나는 속력 (감쇠 없음, 해가 없으면 false)
+    static bool SolveLaunchSpeed(const FVector& StartLocation, const FVector& TargetLocation, float Gravity, float ElevationDeg, float& OutSpeed);
+
+    // 수평으로 목표를 향하고 ElevationDeg만큼 올린 발사 방향
+    static FVector MakeLaunchDirection(const FVector& StartLocation, const FVector& TargetLocation, float ElevationDeg);
+
+    // 던지기 계산 방식이 바뀌면 올림 (구워 둔 던지기 테이블을 무효화)
+    static constexpr int32 ThrowSolverRevision = 1;
 };
\ No newline at end of file
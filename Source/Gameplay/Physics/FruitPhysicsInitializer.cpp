@@ -1,35 +1,5 @@
 #include "FruitPhysicsInitializer.h"
-#include "Kismet/GameplayStatics.h"
-#include "PhysicsEngine/PhysicsSettings.h"
-
-// 정적 멤버 변수 초기화
-FThrowPhysicsResult UFruitPhysicsInitializer::CachedResult;
-FVector UFruitPhysicsInitializer::LastStartLocation = FVector::ZeroVector;
-FVector UFruitPhysicsInitializer::LastTargetLocation = FVector::ZeroVector;
-float UFruitPhysicsInitializer::LastThrowAngle = 0.0f;
-float UFruitPhysicsInitializer::LastBallMass = 0.0f;
-float UFruitPhysicsInitializer::CacheTimeout = 0.0f;
-
-// 캐시 확인 함수
-bool UFruitPhysicsInitializer::CheckCachedResult(const FPhysicsInitData& InitData, FThrowPhysicsResult& OutResult)
-{
-    // 현재 시간 가져오기
-    float CurrentTime = InitData.World ? InitData.World->GetTimeSeconds() : 0.0f;
-    
-    // 입력 파라미터가 이전과 거의 같고, 캐시가 너무 오래되지 않았으면 캐시된 결과 반환
-    if (CachedResult.bSuccess && 
-        (LastStartLocation - InitData.StartLocation).Size() < 1.0f &&
-        (LastTargetLocation - InitData.TargetLocation).Size() < 1.0f &&
-        FMath::Abs(LastThrowAngle - InitData.ThrowAngle) < 0.1f &&
-        FMath::Abs(LastBallMass - InitData.BallMass) < 0.1f &&
-        (CurrentTime - CacheTimeout) < 0.1f) // 0.1초 이내 캐시만 사용
-    {
-        OutResult = CachedResult;
-        return true;
-    }
-    
-    return false;
-}
+#include "FruitPlateSubsystem.h"
 
 // 물리 초기화 통합 함수
 FPhysicsBaseResult UFruitPhysicsInitializer::InitializePhysics(const FPhysicsInitData& InitData)
@@ -53,8 +23,8 @@ void UFruitPhysicsInitializer::InitializeAngles(const FPhysicsInitData& InitData
     Result.UseAngle = FMath::Clamp(InitData.ThrowAngle, UFruitPhysicsHelper::MinThrowAngle, UFruitPhysicsHelper::MaxThrowAngle);
     Result.ThrowAngleRad = FMath::DegreesToRadians(Result.UseAngle);
     
-    // 중력 값 가져오기
-    Result.Gravity = FMath::Abs(GetDefault<UPhysicsSettings>()->DefaultGravityZ);
+    // 중력 값 (미리 수집한 값)
+    Result.Gravity = InitData.Gravity;
 }
 
 // FindPlateInfo 함수 수정
@@ -62,23 +32,15 @@ void UFruitPhysicsInitializer::FindPlateInfo(const FPhysicsInitData& InitData, F
 {
     // 접시 위치는 TargetLocation으로 전달받음
     Result.PlateCenter = InitData.TargetLocation;
-    Result.PlateTopHeight = 0.f;
     
-    // 접시 높이 정보만 계산
-    if (InitData.World)
-    {
-        TArray<AActor*> PlateActors;
-        UGameplayStatics::GetAllActorsWithTag(InitData.World, FName("Plate"), PlateActors);
-        
-        if (PlateActors.Num() > 0)
-        {
-            FVector PlateOrigin;
-            FVector PlateExtent;
-            PlateActors[0]->GetActorBounds(false, PlateOrigin, PlateExtent);
-            
-            Result.PlateTopHeight = PlateOrigin.Z + PlateExtent.Z + 5.0f;
-        }
-    }
+    // 접시 높이는 미리 수집한 값 사용
+    Result.PlateTopHeight = InitData.PlateTopHeight;
+}
+
+float UFruitPhysicsInitializer::FindPlateTopHeight(UWorld* World)
+{
+    const FFruitPlateGeometry& Plate = UFruitPlateSubsystem::Get(World);
+    return Plate.bValid ? Plate.TopHeight + 5.0f : 0.0f;
 }
 
 // 방향 벡터 및 거리 계산 함수
@@ -176,14 +138,4 @@ void UFruitPhysicsInitializer::CalculateLaunchDirection(const FPhysicsInitData&
     // 디버그 로깅
     //UE_LOG(LogTemp, Warning, TEXT("발사 각도: %.1f°, 높이계수: %.2f, 수직성분: %.2f, 수평성분: %.2f"),
     //    Result.UseAngle, Result.HeightFactor, Result.VerticalMultiplier, Result.HorizontalMultiplier);
-}
-
-void UFruitPhysicsInitializer::UpdateCachedResult(const FPhysicsInitData& InitData, const FThrowPhysicsResult& Result, float CurrentTime)
-{
-    LastStartLocation = InitData.StartLocation;
-    LastTargetLocation = InitData.TargetLocation;
-    LastThrowAngle = InitData.ThrowAngle;
-    LastBallMass = InitData.BallMass;
-    CachedResult = Result;
-    CacheTimeout = CurrentTime;
 }
\ No newline at end of file
@@ -17,19 +17,27 @@ struct FPhysicsInitData
     float ThrowAngle;
     float BallMass;
     
+    // 미리 수집한 씬 정보 (계산 중에는 월드에 접근하지 않음)
+    float PlateTopHeight;
+    float Gravity;
+    
     FPhysicsInitData() : 
         World(nullptr),
         StartLocation(FVector::ZeroVector),
         TargetLocation(FVector::ZeroVector),
         ThrowAngle(30.0f),
-        BallMass(30.0f) {}
+        BallMass(30.0f),
+        PlateTopHeight(0.0f),
+        Gravity(980.0f) {}
         
     FPhysicsInitData(UWorld* InWorld, const FVector& InStart, const FVector& InTarget, float InAngle, float InMass) :
         World(InWorld),
         StartLocation(InStart),
         TargetLocation(InTarget),
         ThrowAngle(InAngle),
-        BallMass(InMass) {}
+        BallMass(InMass),
+        PlateTopHeight(0.0f),
+        Gravity(980.0f) {}
 };
 
 // 물리 계산 중간 결과 데이터 구조체
@@ -77,14 +85,12 @@ class UE_FRUITMOUNTAIN_API UFruitPhysicsInitializer : public UObject
     GENERATED_BODY()
     
 public:
-    // 캐시 확인 함수
-    static bool CheckCachedResult(const FPhysicsInitData& InitData, FThrowPhysicsResult& OutResult);
-    
-    // 물리 초기화 통합 함수 - 섹션 0~6 모두 처리
+    // 물리 초기화 통합 함수 - 섹션 0~6 모두 처리 (월드 접근 없음, 워커 스레드에서 호출 가능)
     static FPhysicsBaseResult InitializePhysics(const FPhysicsInitData& InitData);
     
-    // 캐시 결과 업데이트 함수 추가
-    static void UpdateCachedResult(const FPhysicsInitData& InitData, const FThrowPhysicsResult& Result, float CurrentTime);
+    // 접시 윗면 높이 검색 (게임 스레드)
+    static float FindPlateTopHeight(UWorld* World);
+
     
 private:
     // 개별 단계 함수들
@@ -97,12 +103,5 @@ private:
     static void CalculateAdjustedTarget(const FPhysicsInitData& InitData, FPhysicsBaseResult& Result);
         
     static void CalculateLaunchDirection(const FPhysicsInitData& InitData, FPhysicsBaseResult& Result);
-        
-    // 캐시 관련 정적 변수
-    static FThrowPhysicsResult CachedResult;
-    static FVector LastStartLocation;
-    static FVector LastTargetLocation;
-    static float LastThrowAngle;
-    static float LastBallMass;
-    static float CacheTimeout;
+
 };
\ No newline at end of file
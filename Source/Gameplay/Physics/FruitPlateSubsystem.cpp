@@ -0,0 +1,138 @@
+#include "FruitPlateSubsystem.h"
+#include "Actors/PlateActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Plate Geometry Rebuilds"), STAT_FruitPlateGeometryRebuilds, STATGROUP_FruitMountain);
+
+// 스폰 원 반지름은 접시 메시 바운드보다 약간 안쪽
+static constexpr float PlateRimRadiusScale = 0.475f;
+
+FFruitPlateGeometry FFruitPlateGeometry::Build(const APlateActor* Plate, uint32 InRevision)
+{
+    FFruitPlateGeometry Result;
+    Result.Revision = InRevision;
+    if (!Plate)
+    {
+        return Result;
+    }
+
+    Result.Center = Plate->GetActorLocation();
+
+    // 테이블과 접시를 포함한 전체 바운딩 박스 (GetActorBounds와 같은 범위)
+    Result.TableBounds = Plate->GetComponentsBoundingBox(true);
+    if (!Result.TableBounds.IsValid)
+    {
+        return Result;
+    }
+
+    FVector Origin;
+    FVector Extent;
+    Result.TableBounds.GetCenterAndExtents(Origin, Extent);
+
+    Result.AimLocation = Origin + FVector(0.0f, 0.0f, AimHeightOffset);
+    Result.TopHeight = Result.TableBounds.Max.Z;
+
+    // 바운딩 박스 윗면을 원판으로 사용
+    Result.Disc.Center = FVector(Origin.X, Origin.Y, Result.TopHeight);
+    Result.Disc.Radius = FMath::Max(Extent.X, Extent.Y);
+    Result.Disc.bValid = true;
+
+    // 순수 접시 메시만으로 반지름 계산 (X, Y 중 큰 값 기준)
+    if (const UStaticMeshComponent* PlateMesh = Plate->GetPlateMesh())
+    {
+        const FVector PlateSize = PlateMesh->Bounds.GetBox().GetSize();
+        Result.RimRadius = FMath::Max(PlateSize.X, PlateSize.Y) * PlateRimRadiusScale;
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("접시 메시를 찾을 수 없음"));
+    }
+
+    Result.SpawnRing.Build(Result.Center, Result.RimRadius, Result.TableBounds.Max.Z);
+
+    Result.bValid = true;
+    return Result;
+}
+
+bool UFruitPlateSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE || WorldType == EWorldType::Editor;
+}
+
+void UFruitPlateSubsystem::Deinitialize()
+{
+    if (APlateActor* PlateActor = Plate.Get())
+    {
+        UnregisterPlate(PlateActor);
+    }
+    Plate.Reset();
+
+    Super::Deinitialize();
+}
+
+const FFruitPlateGeometry& UFruitPlateSubsystem::Get(const UWorld* World)
+{
+    static const FFruitPlateGeometry InvalidGeometry;
+
+    const UFruitPlateSubsystem* Subsystem = World ? World->GetSubsystem<UFruitPlateSubsystem>() : nullptr;
+    return Subsystem ? Subsystem->GetGeometry() : InvalidGeometry;
+}
+
+void UFruitPlateSubsystem::RegisterPlate(APlateActor* InPlate)
+{
+    if (!InPlate || Plate.Get() == InPlate)
+    {
+        return;
+    }
+
+    if (Plate.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("접시가 이미 등록되어 있어 %s는 사용하지 않습니다."), *InPlate->GetName());
+        return;
+    }
+
+    Plate = InPlate;
+    if (USceneComponent* Root = InPlate->GetRootComponent())
+    {
+        TransformUpdatedHandle = Root->TransformUpdated.AddUObject(this, &UFruitPlateSubsystem::HandlePlateTransformUpdated);
+    }
+    bGeometryDirty = true;
+}
+
+void UFruitPlateSubsystem::UnregisterPlate(APlateActor* InPlate)
+{
+    if (!InPlate || Plate.Get() != InPlate)
+    {
+        return;
+    }
+
+    if (USceneComponent* Root = InPlate->GetRootComponent())
+    {
+        Root->TransformUpdated.Remove(TransformUpdatedHandle);
+    }
+    TransformUpdatedHandle.Reset();
+    Plate.Reset();
+
+    // 접시가 없어졌음을 알리도록 리비전은 올림
+    Geometry = FFruitPlateGeometry::Build(nullptr, NextRevision++);
+    bGeometryDirty = false;
+}
+
+const FFruitPlateGeometry& UFruitPlateSubsystem::GetGeometry() const
+{
+    if (bGeometryDirty)
+    {
+        // 자식 컴포넌트 바운드까지 갱신된 뒤에 읽도록 트랜스폼 변경 시점이 아니라 조회 시점에 다시 만듦
+        INC_DWORD_STAT(STAT_FruitPlateGeometryRebuilds);
+        Geometry = FFruitPlateGeometry::Build(Plate.Get(), NextRevision++);
+        bGeometryDirty = false;
+    }
+    return Geometry;
+}
+
+void UFruitPlateSubsystem::HandlePlateTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+    bGeometryDirty = true;
+}
\ No newline at end of file
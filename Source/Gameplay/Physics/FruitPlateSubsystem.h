@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FruitPhysicsHelper.h"
+#include "Gameplay/Fruit/FruitSpawnRing.h"
+#include "FruitPlateSubsystem.generated.h"
+
+class APlateActor;
+
+/**
+ * 접시 모양 요약 - 접시가 등록되거나 트랜스폼이 바뀔 때만 새로 만들고, 만든 뒤에는 바꾸지 않음
+ * 접시 관련 계산(스폰 위치, 조준점, 착지 원판, 윗면 높이)은 모두 이 값을 읽음
+ */
+struct FFruitPlateGeometry
+{
+    // 접시 액터 위치 (스폰 원 중심)
+    FVector Center = FVector::ZeroVector;
+
+    // 전체 바운드 중심에서 약간 위 (던지기 조준점, 카메라 회전 중심)
+    FVector AimLocation = FVector::ZeroVector;
+
+    // 전체 바운드 윗면 높이
+    float TopHeight = 0.0f;
+
+    // 순수 접시 메시 반지름 (스폰 원 반지름)
+    float RimRadius = 0.0f;
+
+    // 테이블과 접시를 포함한 전체 바운드
+    FBox TableBounds = FBox(ForceInit);
+
+    // 착지 계산용 원판 (바운드 윗면)
+    FFruitPlateDisc Disc;
+
+    // 카메라 각도별 가장자리 스폰 위치
+    FFruitSpawnRing SpawnRing;
+
+    // 다시 만들 때마다 증가 (접시 기준 캐시 무효화용)
+    uint32 Revision = 0;
+
+    bool bValid = false;
+
+    // 조준점은 바운드 중심에서 이만큼 위
+    static constexpr float AimHeightOffset = 10.0f;
+
+    static FFruitPlateGeometry Build(const APlateActor* Plate, uint32 Revision);
+};
+
+/**
+ * 월드의 접시 모양 캐시
+ * APlateActor가 컴포넌트 등록을 마치면 등록하고, 루트 트랜스폼이 바뀌면 다음 조회 때 다시 만듦
+ * 매 호출마다 태그 검색/바운드 계산/컴포넌트 이름 비교를 하지 않도록 함
+ */
+UCLASS()
+class UE_FRUITMOUNTAIN_API UFruitPlateSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // 월드의 접시 모양 (서브시스템이나 접시가 없으면 bValid = false)
+    static const FFruitPlateGeometry& Get(const UWorld* World);
+
+    // 첫 번째로 등록한 접시만 사용
+    void RegisterPlate(APlateActor* InPlate);
+    void UnregisterPlate(APlateActor* InPlate);
+
+    // 트랜스폼이 바뀌었으면 여기서 다시 만듦
+    const FFruitPlateGeometry& GetGeometry() const;
+
+protected:
+    // 굽기 커맨드릿은 에디터 월드를 사용
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    void HandlePlateTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+    TWeakObjectPtr<APlateActor> Plate;
+    FDelegateHandle TransformUpdatedHandle;
+
+    mutable FFruitPlateGeometry Geometry;
+    mutable bool bGeometryDirty = false;
+    mutable uint32 NextRevision = 1;
+};
\ No newline at end of file
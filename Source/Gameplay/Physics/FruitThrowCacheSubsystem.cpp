@@ -0,0 +1,74 @@
+#include "FruitThrowCacheSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throw Cache Hits"), STAT_FruitThrowCacheHits, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throw Cache Misses"), STAT_FruitThrowCacheMisses, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throw Cache Evictions"), STAT_FruitThrowCacheEvictions, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Throw Cache Entries"), STAT_FruitThrowCacheEntries, STATGROUP_FruitMountain);
+
+static TAutoConsoleVariable<int32> CVarFruitThrowCacheCapacity(
+    TEXT("Fruit.ThrowCache.Capacity"),
+    128,
+    TEXT("월드별 던지기 계산 캐시 최대 항목 수 (월드 시작 시 적용)"),
+    ECVF_Default);
+
+FFruitThrowCacheKey FFruitThrowCacheKey::Make(const FVector& StartLocation, const FVector& TargetLocation, float ThrowAngle, float BallMass)
+{
+    FFruitThrowCacheKey Key;
+    Key.Start = FIntVector(FMath::RoundToInt(StartLocation.X), FMath::RoundToInt(StartLocation.Y), FMath::RoundToInt(StartLocation.Z));
+    Key.Target = FIntVector(FMath::RoundToInt(TargetLocation.X), FMath::RoundToInt(TargetLocation.Y), FMath::RoundToInt(TargetLocation.Z));
+    Key.Angle = FMath::RoundToInt(ThrowAngle * 10.0f);
+    Key.Mass = FMath::RoundToInt(BallMass * 10.0f);
+    return Key;
+}
+
+bool UFruitThrowCacheSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFruitThrowCacheSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Cache.Empty(FMath::Max(1, CVarFruitThrowCacheCapacity.GetValueOnGameThread()));
+}
+
+void UFruitThrowCacheSubsystem::Deinitialize()
+{
+    Reset();
+
+    Super::Deinitialize();
+}
+
+bool UFruitThrowCacheSubsystem::Find(const FFruitThrowCacheKey& Key, FThrowPhysicsResult& OutResult)
+{
+    if (const FThrowPhysicsResult* Found = Cache.FindAndTouch(Key))
+    {
+        INC_DWORD_STAT(STAT_FruitThrowCacheHits);
+        OutResult = *Found;
+        return true;
+    }
+
+    INC_DWORD_STAT(STAT_FruitThrowCacheMisses);
+    return false;
+}
+
+void UFruitThrowCacheSubsystem::Add(const FFruitThrowCacheKey& Key, const FThrowPhysicsResult& Result)
+{
+    // 가득 찬 상태에서 새 키를 넣으면 가장 오래 안 쓴 항목이 밀려남
+    if (Cache.Num() >= Cache.Max() && !Cache.Contains(Key))
+    {
+        INC_DWORD_STAT(STAT_FruitThrowCacheEvictions);
+    }
+
+    Cache.Add(Key, Result);
+    SET_DWORD_STAT(STAT_FruitThrowCacheEntries, Cache.Num());
+}
+
+void UFruitThrowCacheSubsystem::Reset()
+{
+    Cache.Empty(Cache.Max());
+    SET_DWORD_STAT(STAT_FruitThrowCacheEntries, 0);
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/LruCache.h"
+#include "FruitPhysicsHelper.h"
+#include "FruitThrowCacheSubsystem.generated.h"
+
+// 던지기 계산 캐시 키 - 입력을 양자화해 같은 칸에 들어오면 같은 결과로 봄
+struct FFruitThrowCacheKey
+{
+    // 시작/목표 위치 (1cm 단위)
+    FIntVector Start = FIntVector::ZeroValue;
+    FIntVector Target = FIntVector::ZeroValue;
+
+    // 각도 (0.1도 단위), 질량 (0.1kg 단위)
+    int32 Angle = 0;
+    int32 Mass = 0;
+
+    static FFruitThrowCacheKey Make(const FVector& StartLocation, const FVector& TargetLocation, float ThrowAngle, float BallMass);
+
+    bool operator==(const FFruitThrowCacheKey& Other) const
+    {
+        return Start == Other.Start && Target == Other.Target && Angle == Other.Angle && Mass == Other.Mass;
+    }
+
+    friend uint32 GetTypeHash(const FFruitThrowCacheKey& Key)
+    {
+        uint32 Hash = GetTypeHash(Key.Start);
+        Hash = HashCombine(Hash, GetTypeHash(Key.Target));
+        Hash = HashCombine(Hash, GetTypeHash(Key.Angle));
+        return HashCombine(Hash, GetTypeHash(Key.Mass));
+    }
+};
+
+/**
+ * 월드별 CalculateThrowPhysics 결과 캐시 (크기 제한 LRU)
+ * 각도를 왔다 갔다 해도 최근 결과가 남아 있고, PIE 인스턴스끼리 결과를 공유하지 않음
+ * 접시가 바뀌면 Reset으로 비움
+ */
+UCLASS()
+class UE_FRUITMOUNTAIN_API UFruitThrowCacheSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // 캐시 조회 (찾으면 가장 최근 사용으로 갱신)
+    bool Find(const FFruitThrowCacheKey& Key, FThrowPhysicsResult& OutResult);
+
+    // 결과 저장 (가득 차면 가장 오래 안 쓴 항목 제거)
+    void Add(const FFruitThrowCacheKey& Key, const FThrowPhysicsResult& Result);
+
+    // 전체 비우기
+    void Reset();
+
+    int32 Num() const { return Cache.Num(); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    TLruCache<FFruitThrowCacheKey, FThrowPhysicsResult> Cache;
+};
\ No newline at end of file
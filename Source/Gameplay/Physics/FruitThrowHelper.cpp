@@ -3,8 +3,313 @@
 #include "FruitPhysicsHelper.h"
 #include "Gameplay/Controller/FruitPlayerController.h"
 #include "Gameplay/Fruit/FruitSpawnHelper.h"
+#include "Gameplay/Fruit/FruitPreviewComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Actors/FruitBall.h"
+#include "System/Asset/FruitAssetSubsystem.h"
+#include "FruitAsyncThrowSolver.h"
+#include "FruitThrowCacheSubsystem.h"
+#include "FruitThrowTable.h"
+#include "FruitPlateSubsystem.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Throw Solution Resolve"), STAT_FruitThrowSolutionResolve, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throw Solution Recomputed"), STAT_FruitThrowSolutionRecomputed, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throw Solution Rotated"), STAT_FruitThrowSolutionRotated, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throw Solution Reused"), STAT_FruitThrowSolutionReused, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throw Solution From Table"), STAT_FruitThrowSolutionFromTable, STATGROUP_FruitMountain);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Throw Solution Cache Entries"), STAT_FruitThrowSolutionCacheEntries, STATGROUP_FruitMountain);
+
+// 스폰 원 중심과 조준점의 허용 오차 (이보다 어긋나면 회전 캐시 사용 안 함)
+static constexpr float RotationPivotTolerance = 1.0f;
+
+// 접시 기준 캐시 최대 항목 수 (넘으면 비우고 다시 채움)
+static constexpr int32 MaxLocalThrowEntries = 256;
+
+// 던지기 결과 계산 - 위치는 Origin 기준으로 저장
+static void ComputeThrow(UWorld* World, const FFruitSpawnRing& SpawnRing, float CameraYaw, float ThrowAngle, int32 BallType, const FVector& TargetLocation, const FVector& Origin, FFruitLocalThrow& OutThrow)
+{
+    const FVector StartLocation = UFruitTrajectoryHelper::RoundVector(SpawnRing.GetSpawnLocation(CameraYaw), 1);
+    
+    // 물리 계산 (검증 포함) 한 번, 궤적 포인트는 그 결과로 계산
+    const float BallMass = UFruitSpawnHelper::CalculateBallMass(BallType);
+    OutThrow.Physics = UFruitPhysicsHelper::CalculateThrowPhysics(World, StartLocation, TargetLocation, ThrowAngle, BallMass);
+    OutThrow.TrajectoryPoints = UFruitTrajectoryHelper::CalculateTrajectoryPoints(World, StartLocation, OutThrow.Physics);
+    
+    OutThrow.StartLocation = StartLocation - Origin;
+    OutThrow.Physics.AdjustedTarget -= Origin;
+    for (FVector& Point : OutThrow.TrajectoryPoints)
+    {
+        Point -= Origin;
+    }
+}
+
+bool UFruitThrowHelper::FindPlateAimLocation(UWorld* World, FVector& OutLocation)
+{
+    const FFruitPlateGeometry& Plate = UFruitPlateSubsystem::Get(World);
+    if (!Plate.bValid)
+    {
+        return false;
+    }
+    
+    OutLocation = Plate.AimLocation;
+    return true;
+}
+
+// 접시가 바뀌면 캐시를 비우고 스폰 원 중심과 씬 정보 다시 수집
+void UFruitThrowHelper::RebuildPlateFrame(UWorld* World, const FVector& PlateLocation, FFruitThrowSolutionCache& Cache)
+{
+    Cache.Reset();
+    Cache.PlateLocation = PlateLocation;
+    
+    const FFruitPlateGeometry& Plate = UFruitPlateSubsystem::Get(World);
+    Cache.PlateRevision = Plate.Revision;
+    
+    // 접시 기준으로 계산해 둔 월드 캐시도 비움
+    if (UFruitThrowCacheSubsystem* ThrowCache = World ? World->GetSubsystem<UFruitThrowCacheSubsystem>() : nullptr)
+    {
+        ThrowCache->Reset();
+    }
+    
+    if (!Plate.bValid || !Plate.SpawnRing.IsValid())
+    {
+        return;
+    }
+    
+    // 카메라 각도별 스폰 위치는 링 조회만 하도록 복사해 둠
+    Cache.SpawnRing = Plate.SpawnRing;
+    
+    // 스폰 위치는 접시 중심에서 카메라 방향으로 반지름만큼 떨어진 원 위에 있으므로 반대편 두 점의 중점이 원 중심
+    const FVector Edge0 = Cache.SpawnRing.GetSpawnLocation(0.0f);
+    const FVector Edge180 = Cache.SpawnRing.GetSpawnLocation(180.0f);
+    
+    Cache.Pivot = FVector((Edge0.X + Edge180.X) * 0.5f, (Edge0.Y + Edge180.Y) * 0.5f, 0.0f);
+    Cache.BaseStartLocation = UFruitTrajectoryHelper::RoundVector(Edge0, 1);
+    Cache.Scene = UFruitPhysicsHelper::GatherThrowScene(World);
+    Cache.bPlateFrameValid = true;
+    
+    // 조준점이 회전 중심 위에 있어야 궤적이 카메라 각도에 대해 회전 불변
+    Cache.bRotationInvariant = FVector::Dist2D(Cache.Pivot, PlateLocation) <= RotationPivotTolerance;
+    if (!Cache.bRotationInvariant)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("스폰 원 중심(%s)과 접시 조준점(%s)이 어긋나 궤적 회전 캐시를 사용하지 않습니다."),
+            *Cache.Pivot.ToString(), *PlateLocation.ToString());
+    }
+}
+
+// 접시 기준 결과를 카메라 각도만큼 회전해 월드 공간 해로 변환 (물리 계산 없음)
+static void ApplyLocalThrow(const FFruitLocalThrow& LocalThrow, const FVector& Pivot, float CameraYaw, FFruitThrowSolution& Solution)
+{
+    const FQuat YawRotation(FVector::UpVector, FMath::DegreesToRadians(CameraYaw));
+    
+    Solution.StartLocation = Pivot + YawRotation.RotateVector(LocalThrow.StartLocation);
+    
+    Solution.Physics = LocalThrow.Physics;
+    Solution.Physics.AdjustedTarget = Pivot + YawRotation.RotateVector(LocalThrow.Physics.AdjustedTarget);
+    Solution.Physics.LaunchVelocity = YawRotation.RotateVector(LocalThrow.Physics.LaunchVelocity);
+    Solution.Physics.LaunchDirection = YawRotation.RotateVector(LocalThrow.Physics.LaunchDirection);
+    
+    Solution.TrajectoryPoints.SetNumUninitialized(LocalThrow.TrajectoryPoints.Num());
+    for (int32 i = 0; i < LocalThrow.TrajectoryPoints.Num(); i++)
+    {
+        Solution.TrajectoryPoints[i] = Pivot + YawRotation.RotateVector(LocalThrow.TrajectoryPoints[i]);
+    }
+}
+
+// 접시 기준 캐시에 결과 추가
+static FFruitLocalThrow& AddLocalThrow(FFruitThrowSolutionCache& Cache, uint32 Key, FFruitLocalThrow&& LocalThrow)
+{
+    if (Cache.Entries.Num() >= MaxLocalThrowEntries)
+    {
+        Cache.Entries.Reset();
+    }
+    
+    FFruitLocalThrow& Added = Cache.Entries.Add(Key, MoveTemp(LocalThrow));
+    SET_DWORD_STAT(STAT_FruitThrowSolutionCacheEntries, Cache.Entries.Num());
+    return Added;
+}
+
+// 입력 상태에 대한 해 조회 - bAllowAsync이면 캐시에 없는 해는 워커에 맡기고 nullptr 반환
+static const FFruitThrowSolution* ResolveThrowSolutionInternal(AFruitPlayerController* Controller, bool bAllowAsync)
+{
+    check(Controller);
+    FFruitThrowSolution& Solution = Controller->ThrowSolution;
+    
+    // 1. 입력값 안정화 - 소수점 아래 1자리까지만 사용
+    FFruitThrowInputState Input;
+    Input.ThrowAngle = FMath::RoundToFloat(Controller->ThrowAngle * 10.0f) / 10.0f;
+    Input.CameraYaw = FMath::RoundToFloat(Controller->CameraOrbitAngle * 10.0f) / 10.0f;
+    Input.BallType = Controller->CurrentBallType;
+    Input.PlateLocation = Controller->PlateLocation;
+    
+    // 2. 입력 상태가 같으면 이전 해 재사용
+    if (Solution.bValid && Solution.Input == Input)
+    {
+        INC_DWORD_STAT(STAT_FruitThrowSolutionReused);
+        return &Solution;
+    }
+    
+    SCOPE_CYCLE_COUNTER(STAT_FruitThrowSolutionResolve);
+    
+    UWorld* World = Controller->GetWorld();
+    
+    // 3. 목표 위치 - 항상 캐시된 접시 위치 사용
+    FVector TargetLocation = Input.PlateLocation;
+    if (TargetLocation == FVector::ZeroVector)
+    {
+        // 캐시된 값이 없으면 기본값 설정 (접시 검색 전)
+        TargetLocation = FVector(0, 0, 100);
+        UE_LOG(LogTemp, Warning, TEXT("접시 위치가 아직 캐싱되지 않음: 기본 위치 사용"));
+    }
+    TargetLocation.Z += UFruitThrowHelper::ThrowTargetHeightOffset;
+    const float BallMass = UFruitSpawnHelper::CalculateBallMass(Input.BallType);
+    
+    // 4. 접시가 바뀌었거나 움직였으면 접시 기준 캐시 다시 만들기 (씬 정보 수집은 여기서만)
+    FFruitThrowSolutionCache& Cache = Controller->ThrowSolutionCache;
+    if (!Cache.bPlateFrameValid || !Cache.PlateLocation.Equals(Input.PlateLocation, 0.0f) ||
+        Cache.PlateRevision != UFruitPlateSubsystem::Get(World).Revision)
+    {
+        UFruitThrowHelper::RebuildPlateFrame(World, Input.PlateLocation, Cache);
+    }
+    
+    if (!Cache.bPlateFrameValid)
+    {
+        // 스폰 위치를 계산할 수 없음 (접시 없음)
+        Solution.Input = Input;
+        Solution.bValid = false;
+        Solution.TrajectoryPoints.Reset();
+        return &Solution;
+    }
+    
+    // 5. 회전 불변이 아니거나 충돌 트레이스가 필요하면 월드를 사용해 현재 카메라 각도로 직접 계산
+    if (!Cache.bRotationInvariant || UFruitTrajectoryHelper::IsCollisionTraceEnabled())
+    {
+        INC_DWORD_STAT(STAT_FruitThrowSolutionRecomputed);
+        
+        const float Yaw = Cache.bRotationInvariant ? 0.0f : Input.CameraYaw;
+        const FVector Origin = Cache.bRotationInvariant ? Cache.Pivot : FVector::ZeroVector;
+        const uint32 Key = FFruitThrowSolutionCache::MakeKey(Input.ThrowAngle, Input.BallType);
+        
+        const FFruitLocalThrow* LocalThrow = Cache.bRotationInvariant ? Cache.Entries.Find(Key) : nullptr;
+        FFruitLocalThrow WorldThrow;
+        if (!LocalThrow)
+        {
+            ComputeThrow(World, Cache.SpawnRing, Yaw, Input.ThrowAngle, Input.BallType, TargetLocation, Origin, WorldThrow);
+            LocalThrow = Cache.bRotationInvariant ? &AddLocalThrow(Cache, Key, MoveTemp(WorldThrow)) : &WorldThrow;
+        }
+        
+        ApplyLocalThrow(*LocalThrow, Origin, Cache.bRotationInvariant ? Input.CameraYaw : 0.0f, Solution);
+        Solution.Input = Input;
+        Solution.TargetLocation = TargetLocation;
+        Solution.BallMass = BallMass;
+        Solution.bValid = true;
+        return &Solution;
+    }
+    
+    // 6. 접시 기준 결과 조회
+    const uint32 Key = FFruitThrowSolutionCache::MakeKey(Input.ThrowAngle, Input.BallType);
+    const FFruitLocalThrow* LocalThrow = Cache.Entries.Find(Key);
+    if (LocalThrow)
+    {
+        INC_DWORD_STAT(STAT_FruitThrowSolutionRotated);
+    }
+    else
+    {
+        // 구워 둔 테이블이 같은 접시 모양이면 보간만 (솔버/트레이스 없음)
+        const UFruitAssetSubsystem* AssetSubsystem = UFruitAssetSubsystem::Get(Controller);
+        const UFruitThrowTable* ThrowTable = AssetSubsystem ? AssetSubsystem->GetThrowTable() : nullptr;
+        FFruitLocalThrow TableThrow;
+        if (ThrowTable && ThrowTable->MatchesPlateFrame(Cache, TargetLocation) &&
+            ThrowTable->Lookup(Input.ThrowAngle, Input.BallType, Cache.Scene.Gravity, TableThrow))
+        {
+            INC_DWORD_STAT(STAT_FruitThrowSolutionFromTable);
+            LocalThrow = &AddLocalThrow(Cache, Key, MoveTemp(TableThrow));
+        }
+    }
+    
+    if (!LocalThrow)
+    {
+        // 씬 정보는 이미 모아 두었으므로 계산은 월드 없이 가능
+        FFruitThrowQuery Query;
+        Query.Key = Key;
+        Query.Generation = Cache.Generation;
+        Query.Scene = Cache.Scene;
+        Query.StartLocation = Cache.BaseStartLocation;
+        Query.TargetLocation = TargetLocation;
+        Query.Origin = Cache.Pivot;
+        Query.ThrowAngle = Input.ThrowAngle;
+        Query.BallMass = BallMass;
+        
+        if (bAllowAsync && Controller->ThrowSolver.IsValid())
+        {
+            // 워커에서 계산 - 완료되면 PollAsyncThrowSolution에서 캐시에 추가 (그동안 이전 해 유지)
+            Controller->ThrowSolver->Request(Query);
+            return nullptr;
+        }
+        
+        // 동기 계산 - 같은 요청이 워커에 있으면 취소
+        INC_DWORD_STAT(STAT_FruitThrowSolutionRecomputed);
+        if (Controller->ThrowSolver.IsValid() && Controller->ThrowSolver->IsPending(Key))
+        {
+            Controller->ThrowSolver->Cancel();
+        }
+        
+        FFruitLocalThrow NewThrow;
+        FFruitAsyncThrowSolver::Solve(Query, NewThrow);
+        LocalThrow = &AddLocalThrow(Cache, Key, MoveTemp(NewThrow));
+    }
+    
+    // 7. 카메라 각도만큼 회전해 월드 공간으로 변환
+    ApplyLocalThrow(*LocalThrow, Cache.Pivot, Input.CameraYaw, Solution);
+    Solution.Input = Input;
+    Solution.TargetLocation = TargetLocation;
+    Solution.BallMass = BallMass;
+    Solution.bValid = true;
+    return &Solution;
+}
+
+const FFruitThrowSolution& UFruitThrowHelper::ResolveThrowSolution(AFruitPlayerController* Controller)
+{
+    return *ResolveThrowSolutionInternal(Controller, false);
+}
+
+const FFruitThrowSolution* UFruitThrowHelper::RequestThrowSolution(AFruitPlayerController* Controller)
+{
+    return ResolveThrowSolutionInternal(Controller, true);
+}
+
+bool UFruitThrowHelper::PollAsyncThrowSolution(AFruitPlayerController* Controller)
+{
+    if (!Controller || !Controller->ThrowSolver.IsValid())
+    {
+        return false;
+    }
+    
+    uint32 Key = 0;
+    uint32 Generation = 0;
+    FFruitLocalThrow LocalThrow;
+    if (!Controller->ThrowSolver->TryConsume(Key, Generation, LocalThrow))
+    {
+        return false;
+    }
+    
+    // 요청 이후 접시가 바뀌었으면 버림
+    FFruitThrowSolutionCache& Cache = Controller->ThrowSolutionCache;
+    if (!Cache.bPlateFrameValid || Cache.Generation != Generation)
+    {
+        return false;
+    }
+    
+    if (!Cache.Entries.Contains(Key))
+    {
+        INC_DWORD_STAT(STAT_FruitThrowSolutionRecomputed);
+        AddLocalThrow(Cache, Key, MoveTemp(LocalThrow));
+    }
+    
+    // 현재 입력 상태의 결과면 미리보기 갱신 필요
+    const float CurrentAngle = FMath::RoundToFloat(Controller->ThrowAngle * 10.0f) / 10.0f;
+    return Key == FFruitThrowSolutionCache::MakeKey(CurrentAngle, Controller->CurrentBallType);
+}
 
 void UFruitThrowHelper::ThrowFruit(AFruitPlayerController* Controller)
 {
@@ -14,28 +319,35 @@ void UFruitThrowHelper::ThrowFruit(AFruitPlayerController* Controller)
         return;
     }
     
-    // 미리보기 공이 있는지 확인하고 필요시 제거
-    if (Controller->PreviewBall)
+    // 미리보기 과일 숨기기 (제거하지 않음)
+    if (UFruitPreviewComponent* Preview = Controller->GetPreviewComponent())
     {
-        Controller->PreviewBall->Destroy();
-        Controller->PreviewBall = nullptr;
+        Preview->HidePreview();
     }
     
-    // 공 스폰 위치 계산
-    FVector SpawnLocation = UFruitSpawnHelper::CalculatePlateEdgeSpawnPosition(Controller->GetWorld(), Controller->CameraOrbitAngle);
+    // 미리보기와 같은 던지기 해 사용 (입력이 그대로면 다시 계산하지 않음)
+    const FFruitThrowSolution& Solution = ResolveThrowSolution(Controller);
     
-    if (SpawnLocation == FVector::ZeroVector)
+    if (!Solution.bValid)
     {
         UE_LOG(LogTemp, Warning, TEXT("유효한 스폰 위치를 계산할 수 없습니다."));
         return;
     }
     
+    const FVector SpawnLocation = Solution.StartLocation;
+    
     // 공 스폰 후 물리 적용 - 즉시 표시되도록 설정
     AActor* SpawnedBall = UFruitSpawnHelper::SpawnBall(Controller, SpawnLocation, Controller->CurrentBallType, true);
     
     // 공 던지기 - 물리 헬퍼 활용하여 힘 적용
     if (SpawnedBall)
     {
+        // 시작부터 첫 던지기까지 시간 기록
+        if (UFruitAssetSubsystem* Assets = UFruitAssetSubsystem::Get(Controller))
+        {
+            Assets->NotifyFirstThrow();
+        }
+        
         UStaticMeshComponent* MeshComp = Cast<UStaticMeshComponent>(
             SpawnedBall->GetComponentByClass(UStaticMeshComponent::StaticClass()));
             
@@ -47,27 +359,11 @@ void UFruitThrowHelper::ThrowFruit(AFruitPlayerController* Controller)
                 MeshComp->SetSimulatePhysics(true);
             }
             
-            // 항상 캐시된 접시 위치 사용
-            FVector PlateCenter = Controller->PlateLocation;
-            if (PlateCenter == FVector::ZeroVector)
-            {
-                // 캐시된 값이 없으면 기본값 설정 (이 코드는 실행되면 안 됨)
-                PlateCenter = FVector(0, 0, 100);
-                UE_LOG(LogTemp, Error, TEXT("접시 위치 캐싱 실패: 기본 위치 사용"));
-            }
-            
-            // 접시 약간 위를 목표로 설정
-            PlateCenter.Z += 10.0f;
-            
             // 물리 시뮬레이션 활성화 상태에서 질량 확인
             float ActualMass = MeshComp->GetMass();
             
-            // 소수점 1자리로 반올림된 각도 사용 (안정성 향상)
-            float RoundedAngle = FMath::RoundToFloat(Controller->ThrowAngle * 10.0f) / 10.0f;
-            
-            // 통합 물리 계산 사용
-            FThrowPhysicsResult PhysicsResult = UFruitPhysicsHelper::CalculateThrowPhysics(
-                Controller->GetWorld(), SpawnLocation, PlateCenter, RoundedAngle, ActualMass);
+            // 미리보기에 표시된 궤적과 같은 결과
+            const FThrowPhysicsResult& PhysicsResult = Solution.Physics;
             
             // 이 시점에서 힘과 방향이 확정
             // 카메라 회전과 무관하게 항상 동일해야 함
@@ -85,17 +381,8 @@ void UFruitThrowHelper::ThrowFruit(AFruitPlayerController* Controller)
     // 다음 공 타입 랜덤 설정
     Controller->CurrentBallType = FMath::RandRange(1, AFruitBall::RandomBallTypeMax);
     
-    // 약간의 딜레이 후 새 미리보기 공 업데이트
-    FTimerHandle UpdatePreviewTimerHandle;
-    Controller->GetWorld()->GetTimerManager().SetTimer(
-        UpdatePreviewTimerHandle, 
-        [Controller]() 
-        { 
-            Controller->UpdatePreviewBallWithDebounce(); 
-        }, 
-        Controller->BallThrowDelay, 
-        false
-    );
+    // 새 미리보기 공 업데이트 요청 (던지기가 끝난 뒤 처리)
+    Controller->MarkPreviewDirty(EFruitPreviewDirty::BallType);
 }
 
 void UFruitThrowHelper::UpdatePreviewBall(AFruitPlayerController* Controller, bool bUpdateRotation)
@@ -113,35 +400,28 @@ void UFruitThrowHelper::UpdatePreviewBall(AFruitPlayerController* Controller, bo
         return;
     }
 
-    // 공 위치 계산
-    FVector PreviewLocation = UFruitSpawnHelper::CalculatePlateEdgeSpawnPosition(Controller->GetWorld(), Controller->CameraOrbitAngle);
-    
-    if (PreviewLocation == FVector::ZeroVector)
+    // 던지기 해 조회 - 캐시에 없으면 워커에서 계산하고 완료될 때까지 이전 미리보기 유지
+    const FFruitThrowSolution* Solution = RequestThrowSolution(Controller);
+    if (!Solution)
     {
-        UE_LOG(LogTemp, Error, TEXT("미리보기 실패: 유효한 위치를 계산할 수 없습니다!"));
         return;
     }
     
-    // 미리보기 공이 있으면 위치만 업데이트
-    if (Controller->PreviewBall)
+    if (!Solution->bValid)
     {
-        // 위치 업데이트
-        Controller->PreviewBall->SetActorLocation(PreviewLocation);
+        UE_LOG(LogTemp, Error, TEXT("미리보기 실패: 유효한 위치를 계산할 수 없습니다!"));
+        return;
     }
-    else
+    
+    const FVector PreviewLocation = Solution->StartLocation;
+    
+    // 폰이 들고 있는 미리보기 과일의 타입/위치만 갱신 (스폰 없음)
+    if (UFruitPreviewComponent* Preview = Controller->GetPreviewComponent())
     {
-        // 기존 미리보기 공 제거 (혹시 무효한 참조가 있을 경우를 대비)
-        if (Controller->PreviewBall)
-        {
-            Controller->PreviewBall->Destroy();
-            Controller->PreviewBall = nullptr;
-        }
-        
-        // 새 미리보기 공 생성
-        Controller->PreviewBall = UFruitSpawnHelper::SpawnBall(Controller, PreviewLocation, Controller->CurrentBallType, false);
+        Preview->SetWorldLocation(PreviewLocation);
+        Preview->ShowBallType(Controller->CurrentBallType);
     }
     
     // 궤적 업데이트 함수 호출
-    FVector PlateCenter = Controller->PlateLocation;
-    UFruitTrajectoryHelper::UpdateTrajectoryPath(Controller, PreviewLocation);
+    UFruitTrajectoryHelper::UpdateTrajectoryPath(Controller);
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "FruitThrowHelper.generated.h"
 
+struct FFruitThrowSolution;
+struct FFruitThrowSolutionCache;
+
 UCLASS()
 class UE_FRUITMOUNTAIN_API UFruitThrowHelper : public UBlueprintFunctionLibrary
 {
@@ -17,4 +20,24 @@ public:
     // 미리보기 공 업데이트 함수
     UFUNCTION(BlueprintCallable, Category="Fruit Throw")// 기존 함수 선언 수정
     static void UpdatePreviewBall(class AFruitPlayerController* Controller, bool bUpdateRotation = true);
+
+    // 현재 입력 상태(각도, 카메라 각도, 공 타입, 접시)의 던지기 해 조회
+    // 입력 상태가 이전과 같으면 캐시된 해를 그대로 반환
+    static const FFruitThrowSolution& ResolveThrowSolution(class AFruitPlayerController* Controller);
+
+    // 미리보기용 조회 - 캐시에 없는 해는 워커 스레드에서 계산하고 nullptr 반환 (대기 없음)
+    static const FFruitThrowSolution* RequestThrowSolution(class AFruitPlayerController* Controller);
+
+    // 완료된 비동기 결과를 캐시에 반영 (게임 스레드, 매 프레임)
+    // 현재 입력 상태의 결과가 도착했으면 true - 미리보기를 다시 갱신해야 함
+    static bool PollAsyncThrowSolution(class AFruitPlayerController* Controller);
+
+    // 접시 조준점 (바운드 중심에서 약간 위, UFruitPlateSubsystem의 접시 모양) - 접시가 없으면 false
+    static bool FindPlateAimLocation(UWorld* World, FVector& OutLocation);
+
+    // 접시 기준 틀(회전 중심, 기준 스폰 위치, 씬 정보) 다시 만들기 - 캐시는 비움
+    static void RebuildPlateFrame(UWorld* World, const FVector& PlateLocation, FFruitThrowSolutionCache& Cache);
+
+    // 목표는 조준점 약간 위
+    static constexpr float ThrowTargetHeightOffset = 10.0f;
 };
\ No newline at end of file
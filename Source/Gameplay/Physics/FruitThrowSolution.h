@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FruitPhysicsHelper.h"
+#include "Gameplay/Fruit/FruitSpawnRing.h"
+
+// 던지기 입력 상태 - 이 값이 바뀔 때만 던지기 해를 다시 계산
+struct FFruitThrowInputState
+{
+    // 던지기 각도 (소수점 첫째자리 반올림)
+    float ThrowAngle = 0.0f;
+
+    // 카메라 오빗 각도 (소수점 첫째자리 반올림)
+    float CameraYaw = 0.0f;
+
+    int32 BallType = 0;
+
+    // 접시 위치 (접시가 바뀌면 다시 계산)
+    FVector PlateLocation = FVector::ZeroVector;
+
+    bool operator==(const FFruitThrowInputState& Other) const
+    {
+        return ThrowAngle == Other.ThrowAngle
+            && CameraYaw == Other.CameraYaw
+            && BallType == Other.BallType
+            && PlateLocation.Equals(Other.PlateLocation, 0.0f);
+    }
+};
+
+/**
+ * 입력 상태 하나에 대한 던지기 해
+ * 미리보기 위치, 궤적 그리기, 실제 던지기가 모두 같은 결과를 사용
+ * 스폰 위치 계산(월드 검색)과 물리 계산(검증 포함)은 입력 상태가 바뀔 때 한 번만 수행
+ */
+struct FFruitThrowSolution
+{
+    FFruitThrowInputState Input;
+
+    // 스폰(발사) 위치
+    FVector StartLocation = FVector::ZeroVector;
+
+    // 목표 위치 (접시 약간 위)
+    FVector TargetLocation = FVector::ZeroVector;
+
+    float BallMass = 0.0f;
+
+    FThrowPhysicsResult Physics;
+
+    // 미리보기 궤적 포인트
+    TArray<FVector> TrajectoryPoints;
+
+    bool bValid = false;
+
+    // 다음 조회 때 다시 계산하도록 표시
+    void Invalidate() { bValid = false; }
+};
+
+// 카메라 각도 0에서 구한 던지기 결과 (위치는 모두 회전 중심 기준)
+// 접시가 축대칭이므로 카메라 각도만큼 회전하면 그 각도의 결과와 같음
+struct FFruitLocalThrow
+{
+    FVector StartLocation = FVector::ZeroVector;
+
+    // AdjustedTarget은 회전 중심 기준, 방향/속도는 회전만 적용
+    FThrowPhysicsResult Physics;
+
+    TArray<FVector> TrajectoryPoints;
+};
+
+/**
+ * 접시 기준 던지기 결과 캐시 - (던지기 각도, 공 타입)으로 조회
+ * 카메라 회전은 캐시된 결과를 회전 변환만 하고 물리 계산/트레이스는 하지 않음
+ * 접시 위치나 접시 모양(리비전)이 바뀌면 전체를 비움
+ */
+struct FFruitThrowSolutionCache
+{
+    // 캐시를 만들 때의 접시 위치
+    FVector PlateLocation = FVector::ZeroVector;
+
+    // 캐시를 만들 때의 접시 모양 리비전 (FFruitPlateGeometry::Revision)
+    uint32 PlateRevision = 0;
+
+    // 스폰 원의 중심 (카메라 회전 중심)
+    FVector Pivot = FVector::ZeroVector;
+
+    // 카메라 각도 0의 스폰 위치 (월드)
+    FVector BaseStartLocation = FVector::ZeroVector;
+
+    // 카메라 각도별 스폰 위치 (접시 모양의 링 사본)
+    FFruitSpawnRing SpawnRing;
+
+    // 접시를 다시 잡을 때 모아 둔 씬 정보 (워커 스레드 계산에 전달)
+    FFruitThrowScene Scene;
+
+    // 접시가 바뀔 때마다 증가 (이전 접시 기준 비동기 결과를 버리는 용도)
+    uint32 Generation = 0;
+
+    // 스폰 원 중심과 조준점이 어긋나 있으면 회전 불변이 아니므로 캐시를 쓰지 않음
+    bool bRotationInvariant = false;
+
+    bool bPlateFrameValid = false;
+
+    TMap<uint32, FFruitLocalThrow> Entries;
+
+    // 각도는 소수점 첫째자리 단위
+    static uint32 MakeKey(float ThrowAngle, int32 BallType)
+    {
+        return (static_cast<uint32>(FMath::RoundToInt(ThrowAngle * 10.0f)) << 8) | static_cast<uint32>(BallType & 0xFF);
+    }
+
+    void Reset()
+    {
+        Generation++;
+        bPlateFrameValid = false;
+        bRotationInvariant = false;
+        Entries.Reset();
+    }
+};
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include "FruitThrowTable.h"
+#include "FruitPhysicsHelper.h"
+#include "FruitThrowHelper.h"
+#include "FruitTrajectoryHelper.h"
+#include "Gameplay/Fruit/FruitTypeCatalog.h"
+#include "Actors/FruitBall.h"
+
+// 저장 형식이 바뀌면 올림
+static constexpr int32 ThrowTableFormatVersion = 1;
+
+// 접시 모양 비교 허용 오차 (cm)
+static constexpr float PlateFrameTolerance = 0.5f;
+
+uint32 UFruitThrowTable::ComputeSolverVersion(float Gravity)
+{
+    uint32 Hash = GetTypeHash(ThrowTableFormatVersion);
+    auto Mix = [&Hash](auto Value)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Value));
+    };
+
+    Mix(UFruitPhysicsHelper::ThrowSolverRevision);
+    Mix(UFruitPhysicsHelper::MinThrowAngle);
+    Mix(UFruitPhysicsHelper::MaxThrowAngle);
+    Mix(UFruitThrowHelper::ThrowTargetHeightOffset);
+    Mix(UFruitTrajectoryHelper::TrajectoryProbeRadius);
+    Mix(UFruitTrajectoryHelper::TrajectoryMaxSimTime);
+    Mix(UFruitTrajectoryHelper::MissDropHeight);
+    Mix(Gravity);
+
+    // 질량은 충격량(AdjustedForce)에 들어감
+    for (int32 BallType = 1; BallType <= AFruitBall::MaxBallType; BallType++)
+    {
+        Mix(FFruitTypeTable::Get(BallType).Mass);
+    }
+    return Hash;
+}
+
+float UFruitThrowTable::GetSampleAngle(int32 AngleIndex) const
+{
+    return FMath::Min(MinAngle + AngleIndex * AngleStep, UFruitPhysicsHelper::MaxThrowAngle);
+}
+
+void UFruitThrowTable::Bake(const FFruitThrowSolutionCache& PlateFrame, const FVector& TargetLocation, float InAngleStep, int32 InPointsPerPath)
+{
+    const FFruitThrowScene& Scene = PlateFrame.Scene;
+    const FVector& Pivot = PlateFrame.Pivot;
+    const FVector& StartLocation = PlateFrame.BaseStartLocation;
+
+    SolverVersion = ComputeSolverVersion(Scene.Gravity);
+    MinAngle = UFruitPhysicsHelper::MinThrowAngle;
+    AngleStep = FMath::Max(InAngleStep, 0.1f);
+    NumAngles = FMath::CeilToInt((UFruitPhysicsHelper::MaxThrowAngle - MinAngle) / AngleStep - KINDA_SMALL_NUMBER) + 1;
+    NumBallTypes = AFruitBall::MaxBallType;
+    PointsPerPath = FMath::Max(InPointsPerPath, 2);
+
+    LocalStartLocation = FVector3f(StartLocation - Pivot);
+    LocalTargetLocation = FVector3f(TargetLocation - Pivot);
+    LocalPlateCenter = FVector3f(Scene.PlateDisc.Center - Pivot);
+    PlateRadius = Scene.PlateDisc.Radius;
+
+    const int32 NumSamples = NumBallTypes * NumAngles;
+    LaunchVelocities.Reset(NumSamples);
+    AdjustedTargets.Reset(NumSamples);
+    PathPoints.Reset(NumSamples * PointsPerPath);
+
+    const float GravityZ = -Scene.Gravity;
+    for (int32 BallType = 1; BallType <= NumBallTypes; BallType++)
+    {
+        const float BallMass = AFruitBall::CalculateBallMass(BallType);
+        for (int32 AngleIndex = 0; AngleIndex < NumAngles; AngleIndex++)
+        {
+            // CalculateThrowPhysics와 같은 계산 (캐시/월드 없이)
+            const FThrowPhysicsResult Physics = UFruitPhysicsHelper::SolveThrow(Scene, StartLocation, TargetLocation, GetSampleAngle(AngleIndex), BallMass);
+            LaunchVelocities.Add(FVector3f(Physics.LaunchVelocity));
+            AdjustedTargets.Add(FVector3f(Physics.AdjustedTarget - Pivot));
+
+            // 착지 시간까지 같은 시간 간격으로 샘플 (끝점은 정확한 착지 지점)
+            float FlightTime = 0.0f;
+            FVector EndPoint;
+            UFruitTrajectoryHelper::SolveLanding(StartLocation, Physics.LaunchVelocity, GravityZ,
+                Scene.PlateDisc, UFruitTrajectoryHelper::TrajectoryProbeRadius, FlightTime, EndPoint);
+
+            for (int32 PointIndex = 0; PointIndex < PointsPerPath - 1; PointIndex++)
+            {
+                const float Time = FlightTime * PointIndex / (PointsPerPath - 1);
+                const FVector Point = StartLocation + Physics.LaunchVelocity * Time + FVector(0.0f, 0.0f, 0.5f * GravityZ * Time * Time);
+                PathPoints.Add(FVector3f(Point - Pivot));
+            }
+            PathPoints.Add(FVector3f(EndPoint - Pivot));
+        }
+    }
+}
+
+bool UFruitThrowTable::MatchesPlateFrame(const FFruitThrowSolutionCache& PlateFrame, const FVector& TargetLocation) const
+{
+    const FVector& Pivot = PlateFrame.Pivot;
+    return FVector(LocalStartLocation).Equals(PlateFrame.BaseStartLocation - Pivot, PlateFrameTolerance)
+        && FVector(LocalTargetLocation).Equals(TargetLocation - Pivot, PlateFrameTolerance)
+        && FVector(LocalPlateCenter).Equals(PlateFrame.Scene.PlateDisc.Center - Pivot, PlateFrameTolerance)
+        && FMath::IsNearlyEqual(PlateRadius, PlateFrame.Scene.PlateDisc.Radius, PlateFrameTolerance);
+}
+
+bool UFruitThrowTable::Lookup(float ThrowAngle, int32 BallType, float Gravity, FFruitLocalThrow& OutThrow) const
+{
+    if (NumAngles < 2 || BallType < 1 || BallType > NumBallTypes ||
+        LaunchVelocities.Num() != NumBallTypes * NumAngles ||
+        AdjustedTargets.Num() != LaunchVelocities.Num() ||
+        PathPoints.Num() != LaunchVelocities.Num() * PointsPerPath)
+    {
+        return false;
+    }
+
+    if (ThrowAngle < MinAngle - KINDA_SMALL_NUMBER || ThrowAngle > GetSampleAngle(NumAngles - 1) + KINDA_SMALL_NUMBER)
+    {
+        return false;
+    }
+
+    // 양옆 각도 샘플과 보간 비율 (마지막 구간은 간격이 짧을 수 있음)
+    const int32 AngleIndex = FMath::Clamp(FMath::FloorToInt((ThrowAngle - MinAngle) / AngleStep), 0, NumAngles - 2);
+    const float Angle0 = GetSampleAngle(AngleIndex);
+    const float Angle1 = GetSampleAngle(AngleIndex + 1);
+    const float Alpha = FMath::Clamp((ThrowAngle - Angle0) / FMath::Max(Angle1 - Angle0, KINDA_SMALL_NUMBER), 0.0f, 1.0f);
+
+    const int32 Sample0 = GetSampleIndex(BallType, AngleIndex);
+    const int32 Sample1 = Sample0 + 1;
+
+    const FVector Velocity(FMath::Lerp(LaunchVelocities[Sample0], LaunchVelocities[Sample1], Alpha));
+
+    OutThrow.StartLocation = FVector(LocalStartLocation);
+
+    FThrowPhysicsResult& Physics = OutThrow.Physics;
+    Physics = FThrowPhysicsResult();
+    Physics.AdjustedTarget = FVector(FMath::Lerp(AdjustedTargets[Sample0], AdjustedTargets[Sample1], Alpha));
+    Physics.LaunchVelocity = Velocity;
+    Physics.InitialSpeed = Velocity.Size();
+    Physics.LaunchDirection = Velocity.GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+    Physics.AdjustedForce = AFruitBall::CalculateBallMass(BallType) * Physics.InitialSpeed;
+    Physics.PeakHeight = Velocity.Z > 0.0f ? FMath::Square(Velocity.Z) / (2.0f * Gravity) : 0.0f;
+    Physics.bSuccess = true;
+
+    const FVector3f* Path0 = &PathPoints[Sample0 * PointsPerPath];
+    const FVector3f* Path1 = &PathPoints[Sample1 * PointsPerPath];
+    OutThrow.TrajectoryPoints.SetNumUninitialized(PointsPerPath);
+    for (int32 PointIndex = 0; PointIndex < PointsPerPath; PointIndex++)
+    {
+        OutThrow.TrajectoryPoints[PointIndex] = FVector(FMath::Lerp(Path0[PointIndex], Path1[PointIndex], Alpha));
+    }
+    return true;
+}
+
+float UFruitThrowTable::MeasureInterpolationError(const FFruitThrowSolutionCache& PlateFrame, const FVector& TargetLocation) const
+{
+    const FFruitThrowScene& Scene = PlateFrame.Scene;
+    const FVector& StartLocation = PlateFrame.BaseStartLocation;
+
+    float MaxError = 0.0f;
+    FFruitLocalThrow Baked;
+    for (int32 BallType : { 1, NumBallTypes })
+    {
+        const float BallMass = AFruitBall::CalculateBallMass(BallType);
+        for (int32 AngleIndex = 0; AngleIndex < NumAngles - 1; AngleIndex++)
+        {
+            // 샘플 사이 가운데 각도에서 비교
+            const float Angle = (GetSampleAngle(AngleIndex) + GetSampleAngle(AngleIndex + 1)) * 0.5f;
+            if (!Lookup(Angle, BallType, Scene.Gravity, Baked))
+            {
+                continue;
+            }
+
+            const FThrowPhysicsResult Physics = UFruitPhysicsHelper::SolveThrow(Scene, StartLocation, TargetLocation, Angle, BallMass);
+            float FlightTime = 0.0f;
+            FVector EndPoint;
+            UFruitTrajectoryHelper::SolveLanding(StartLocation, Physics.LaunchVelocity, -Scene.Gravity,
+                Scene.PlateDisc, UFruitTrajectoryHelper::TrajectoryProbeRadius, FlightTime, EndPoint);
+
+            MaxError = FMath::Max(MaxError, FVector::Dist(Baked.TrajectoryPoints.Last() + PlateFrame.Pivot, EndPoint));
+        }
+    }
+    return MaxError;
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "FruitThrowSolution.h"
+#include "FruitThrowTable.generated.h"
+
+/**
+ * 미리 구운 던지기 결과 테이블 (UFruitThrowTableBakeCommandlet으로 생성)
+ * (공 타입, 던지기 각도) 샘플마다 발사 속도와 궤적 폴리라인을 회전 중심 기준으로 저장
+ * 게임 중에는 인접한 두 각도 샘플을 보간만 하고 솔버/트레이스는 사용하지 않음
+ * 솔버 상수가 바뀌면 SolverVersion이 달라져 사용하지 않음 (다시 구워야 함)
+ */
+UCLASS(BlueprintType)
+class UE_FRUITMOUNTAIN_API UFruitThrowTable : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    // 솔버 상수(각도 범위, 궤적 상수, 목표 높이, 중력, 과일 질량)와 솔버 개정 번호의 해시
+    static uint32 ComputeSolverVersion(float Gravity);
+
+    // 접시 기준 틀(회전 중심, 스폰 위치, 씬 정보)에서 모든 공 타입 x 각도 샘플 굽기
+    void Bake(const FFruitThrowSolutionCache& PlateFrame, const FVector& TargetLocation, float InAngleStep, int32 InPointsPerPath);
+
+    // 구운 시점과 같은 솔버 상수인지
+    bool IsUpToDate(float Gravity) const { return SolverVersion == ComputeSolverVersion(Gravity); }
+
+    // 구운 시점과 같은 접시 모양인지 (회전 중심 기준 상대 위치 비교)
+    bool MatchesPlateFrame(const FFruitThrowSolutionCache& PlateFrame, const FVector& TargetLocation) const;
+
+    // 각도 보간 결과 (위치는 회전 중심 기준) - 샘플 범위를 벗어나면 false
+    bool Lookup(float ThrowAngle, int32 BallType, float Gravity, FFruitLocalThrow& OutThrow) const;
+
+    // 구운 결과와 솔버 결과의 차이 (샘플 사이 각도에서 궤적 끝점 기준 최대 오차, cm)
+    float MeasureInterpolationError(const FFruitThrowSolutionCache& PlateFrame, const FVector& TargetLocation) const;
+
+    int32 GetNumSamples() const { return LaunchVelocities.Num(); }
+
+    UPROPERTY(VisibleAnywhere, Category = "Throw Table")
+    uint32 SolverVersion = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Throw Table")
+    float MinAngle = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, Category = "Throw Table")
+    float AngleStep = 1.0f;
+
+    UPROPERTY(VisibleAnywhere, Category = "Throw Table")
+    int32 NumAngles = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Throw Table")
+    int32 NumBallTypes = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Throw Table")
+    int32 PointsPerPath = 0;
+
+    // 구운 시점의 접시 모양 (모두 회전 중심 기준)
+    UPROPERTY(VisibleAnywhere, Category = "Throw Table")
+    FVector3f LocalStartLocation = FVector3f::ZeroVector;
+
+    UPROPERTY(VisibleAnywhere, Category = "Throw Table")
+    FVector3f LocalTargetLocation = FVector3f::ZeroVector;
+
+    UPROPERTY(VisibleAnywhere, Category = "Throw Table")
+    FVector3f LocalPlateCenter = FVector3f::ZeroVector;
+
+    UPROPERTY(VisibleAnywhere, Category = "Throw Table")
+    float PlateRadius = 0.0f;
+
+    // 샘플 (인덱스 = (BallType - 1) * NumAngles + 각도 인덱스)
+    UPROPERTY()
+    TArray<FVector3f> LaunchVelocities;
+
+    UPROPERTY()
+    TArray<FVector3f> AdjustedTargets;
+
+    // 궤적 폴리라인 (샘플마다 PointsPerPath개, 비행 시간을 같은 간격으로 나눈 점)
+    UPROPERTY()
+    TArray<FVector3f> PathPoints;
+
+private:
+    int32 GetSampleIndex(int32 BallType, int32 AngleIndex) const { return (BallType - 1) * NumAngles + AngleIndex; }
+
+    // 각도 샘플 값 (마지막 샘플은 최대 각도로 제한)
+    float GetSampleAngle(int32 AngleIndex) const;
+};
\ No newline at end of file
@@ -1,186 +1,242 @@
 #include "FruitTrajectoryHelper.h"
 #include "FruitPhysicsHelper.h"
+#include "FruitThrowHelper.h"
 #include "Gameplay/Fruit/FruitSpawnHelper.h"
 #include "Gameplay/Controller/FruitPlayerController.h"
 #include "Kismet/GameplayStatics.h"
-#include "Components/LineBatchComponent.h"
+#include "FruitTrajectoryRenderComponent.h"
 #include "PhysicsEngine/PhysicsSettings.h"
 #include "Actors/FruitBall.h"
+#include "Gameplay/Fruit/FruitRegistrySubsystem.h"
+#include "FruitPlateSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "UE_FruitMountain.h"
 
-ULineBatchComponent* UFruitTrajectoryHelper::CustomLineBatcher = nullptr;
+DECLARE_CYCLE_STAT(TEXT("Trajectory Points"), STAT_FruitTrajectoryPoints, STATGROUP_FruitMountain);
 
-void UFruitTrajectoryHelper::UpdateTrajectoryPath(AFruitPlayerController* Controller, const FVector& StartLocation, bool bPersistent, int32 CustomTrajectoryID)
+static TAutoConsoleVariable<int32> CVarFruitTrajectoryTraceCollision(
+    TEXT("Fruit.Trajectory.TraceCollision"),
+    0,
+    TEXT("1: 궤적을 PredictProjectilePath 충돌 트레이스로 계산 (기존 방식), 0: 포물선과 접시 윗면 교점으로 해석적 계산"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFruitTrajectoryPileAware(
+    TEXT("Fruit.Trajectory.PileAware"),
+    1,
+    TEXT("1: 착지한 과일 더미(구 집합)와 처음 닿는 지점에서 궤적을 자르고 접촉 지점 표시, 0: 과일 더미 무시"),
+    ECVF_Default);
+
+// 궤적 선분이 실제 포물선에서 벗어나도 되는 최대 거리 (cm)
+static constexpr float TrajectoryChordTolerance = 0.25f;
+static constexpr int32 TrajectoryMinSegments = 4;
+static constexpr int32 TrajectoryMaxSegments = 64;
+
+void UFruitTrajectoryHelper::UpdateTrajectoryPath(AFruitPlayerController* Controller, bool bPersistent, int32 CustomTrajectoryID)
 {
     if (!Controller || !Controller->GetWorld())
         return;
     
-    UWorld* World = Controller->GetWorld();
     const int32 TrajectoryID = (CustomTrajectoryID != 0) ? CustomTrajectoryID : 9999;
     
-    // 1. 입력값 안정화 - 입력 좌표를 소수점 아래 1자리까지만 사용
-    FVector StableStartLocation = RoundVector(StartLocation, 1);
-    float StableAngle = FMath::RoundToFloat(Controller->ThrowAngle * 10.0f) / 10.0f; // 소수점 첫째자리까지
+    // 던지기 해 조회 - 미리보기 공 위치와 실제 던지기가 같은 결과를 사용
+    // 입력 상태(각도, 카메라 각도, 공 타입, 접시)가 그대로면 다시 계산하지 않고, 계산 중이면 이전 궤적 유지
+    const FFruitThrowSolution* Solution = UFruitThrowHelper::RequestThrowSolution(Controller);
+    if (!Solution || !Solution->bValid)
+        return;
+    
+    UWorld* World = Controller->GetWorld();
+    UFruitTrajectoryRenderComponent* RenderComponent = FindRenderComponent(World);
     
-    // 항상 캐시된 접시 위치 사용 (더 이상 직접 찾지 않음)
-    FVector PlateCenter = Controller->PlateLocation;
+    // 과일 더미 충돌 예측 - 던지는 과일 크기로 더미와 처음 닿는 지점까지만 궤적을 그리고 접촉 위치 표시
+    if (IsPileAwareEnabled())
+    {
+        const float ProbeRadius = AFruitBall::CalculateBallSize(Solution->Input.BallType) * 0.5f;
+        FFruitPileContact Contact;
+        if (FindPileContact(World, Solution->TrajectoryPoints, ProbeRadius, Contact))
+        {
+            // 자른 궤적은 렌더 컴포넌트의 버퍼에서 구성 (월드마다 따로 유지)
+            if (RenderComponent)
+            {
+                RenderComponent->SetClippedTrajectory(Solution->TrajectoryPoints, Contact.SegmentIndex + 1, Contact.ProbeCenter);
+                RenderComponent->SetContactPoint(Contact.ProbeCenter, ProbeRadius);
+            }
+            return;
+        }
+    }
     
-    // 2. 공의 질량 계산
-    float BallMass = UFruitSpawnHelper::CalculateBallMass(Controller->CurrentBallType);
+    // 궤적 시각화
+    DrawTrajectoryPath(World, Solution->TrajectoryPoints, TrajectoryID);
+    if (RenderComponent)
+    {
+        RenderComponent->ClearContactPoint();
+    }
+}
+
+// 궤적 시각화 함수 - 플레이어 폰의 궤적 렌더 컴포넌트에 전달 (바뀐 구간만 갱신)
+void UFruitTrajectoryHelper::DrawTrajectoryPath(UWorld* World, const TArray<FVector>& Points, int32 TrajectoryID)
+{
+    if (!World || Points.Num() < 2)
+    {
+        return;
+    }
+    
+    if (UFruitTrajectoryRenderComponent* RenderComponent = FindRenderComponent(World))
+    {
+        RenderComponent->SetTrajectory(Points);
+    }
+}
+
+UFruitTrajectoryRenderComponent* UFruitTrajectoryHelper::FindRenderComponent(UWorld* World)
+{
+    APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+    return Pawn ? Pawn->FindComponentByClass<UFruitTrajectoryRenderComponent>() : nullptr;
+}
+
+// 이 함수는 FruitPhysicsHelper에서 이동됨
+TArray<FVector> UFruitTrajectoryHelper::CalculateTrajectoryPoints(UWorld* World, const FVector& StartLocation, const FThrowPhysicsResult& PhysicsResult)
+{
+    TArray<FVector> TrajectoryPoints;
     
-    // 3. 물리 계산 결과 가져오기
-    static FThrowPhysicsResult LastPhysicsResult; // 마지막 결과 저장용 정적 변수
-    FThrowPhysicsResult PhysicsResult = UFruitPhysicsHelper::CalculateThrowPhysics(
-        World, StableStartLocation, PlateCenter, StableAngle, BallMass);
+    if (!World)
+        return TrajectoryPoints;
     
-    // 중요: 정적 변수를 사용하여 이전 결과와 비교할 때 카메라 각도 무시
-    static float LastAngle = 0.0f;
-    static FVector LastStartLoc = FVector::ZeroVector;
+    SCOPE_CYCLE_COUNTER(STAT_FruitTrajectoryPoints);
     
-    // 스폰 위치와 각도만 비교 (카메라 회전은 무시)
-    bool bSimilarConditions = 
-        FMath::Abs(LastAngle - StableAngle) < 0.1f &&
-        (LastStartLoc - StableStartLocation).Size() < 1.0f;
+    const float GravityZ = -FMath::Abs(GetDefault<UPhysicsSettings>()->DefaultGravityZ);
     
-    // 결과 안정화 - 동일한 조건에서 이전 결과 재사용
-    if (LastPhysicsResult.bSuccess && bSimilarConditions)
+    // 기본은 해석적 계산 (트레이스 없음), 필요할 때만 충돌 트레이스
+    if (IsCollisionTraceEnabled())
     {
-        PhysicsResult = LastPhysicsResult;
+        TraceTrajectoryPoints(World, StartLocation, PhysicsResult.LaunchVelocity, GravityZ, TrajectoryPoints);
     }
     else
     {
-        LastPhysicsResult = PhysicsResult;
-        LastAngle = StableAngle;
-        LastStartLoc = StableStartLocation;
+        CalculateAnalyticTrajectoryPoints(GetPlateDisc(World), StartLocation, PhysicsResult.LaunchVelocity, GravityZ, TrajectoryPoints);
     }
     
-    // 스폰 위치와 카메라 각도 로깅 - 주석 처리
-    float HorizontalDistance = FVector(PlateCenter - StableStartLocation).Size2D();
+    return TrajectoryPoints;
+}
 
-    // UE_LOG(LogTemp, Warning, TEXT("궤적 업데이트: 카메라각도=%.1f°, 스폰위치=%s, 거리=%.1f"),
-    //     Controller->CameraOrbitAngle, 
-    //     *StableStartLocation.ToString(), 
-    //     HorizontalDistance);
-    
-    // 5. 물리 기반 궤적 계산 (bezier 궤적은 사용하지 않음)
-    TArray<FVector> TrajectoryPoints = CalculateTrajectoryPoints(World, StableStartLocation, PlateCenter, StableAngle, BallMass);
+bool UFruitTrajectoryHelper::IsCollisionTraceEnabled()
+{
+    return CVarFruitTrajectoryTraceCollision.GetValueOnGameThread() != 0;
+}
 
-    // 6. 궤적 시각화
-    DrawTrajectoryPath(World, TrajectoryPoints, TrajectoryID);
+bool UFruitTrajectoryHelper::IsPileAwareEnabled()
+{
+    return CVarFruitTrajectoryPileAware.GetValueOnGameThread() != 0;
 }
 
-// 궤적 시각화 함수 수정
-void UFruitTrajectoryHelper::DrawTrajectoryPath(UWorld* World, const TArray<FVector>& Points, int32 TrajectoryID)
+bool UFruitTrajectoryHelper::FindPileContact(UWorld* World, TConstArrayView<FVector> Points, float ProbeRadius, FFruitPileContact& OutContact)
 {
-    if (!World || Points.Num() < 2)
+    UFruitRegistrySubsystem* Registry = World ? World->GetSubsystem<UFruitRegistrySubsystem>() : nullptr;
+    if (!Registry)
     {
-        return;
+        return false;
     }
     
-    // 커스텀 라인 배처 초기화 또는 재사용
-    if (!CustomLineBatcher || !CustomLineBatcher->IsValidLowLevel())
+    // 구 집합은 프레임당 한 번만 구성되므로 같은 프레임의 여러 질의가 공유
+    return Registry->GetPileSphereSet().SweepPath(Points, ProbeRadius, OutContact);
+}
+
+const FFruitPlateDisc& UFruitTrajectoryHelper::GetPlateDisc(UWorld* World)
+{
+    return UFruitPlateSubsystem::Get(World).Disc;
+}
+
+bool UFruitTrajectoryHelper::SolveLanding(const FVector& Start, const FVector& Velocity, float GravityZ, const FFruitPlateDisc& Disc, float ProbeRadius, float& OutFlightTime, FVector& OutEnd)
+{
+    // Z(t) = Start.Z + Vz*t + 0.5*g*t^2 = Height 의 큰 근 (내려오면서 지나는 시점)
+    auto SolveDescending = [&](float Height, float& OutTime) -> bool
     {
-        // 새로운 액터 생성
-        AActor* LineActor = World->SpawnActor<AActor>();
-        
-        // 액터에 라인 배처 추가
-        CustomLineBatcher = NewObject<ULineBatchComponent>(LineActor);
-        CustomLineBatcher->RegisterComponent();
-        
-        // 중요: 라인 배처가 카메라의 영향을 받지 않도록 설정
-        if (LineActor->GetRootComponent())
+        const float A = 0.5f * GravityZ;
+        const float B = Velocity.Z;
+        const float C = Start.Z - Height;
+        const float Discriminant = B * B - 4.0f * A * C;
+        if (Discriminant < 0.0f || FMath::IsNearlyZero(A))
         {
-            LineActor->GetRootComponent()->SetAbsolute(true, true, true);
+            return false;
         }
-    }
-    
-    // 항상 먼저 Flush 실행 - Shipping 빌드에서 중요
-    CustomLineBatcher->Flush();
-    
-    FColor PathColor = FColor(135, 206, 235, 255);
-    float LineThickness = 0.8f;
+        OutTime = (-B - FMath::Sqrt(Discriminant)) / (2.0f * A);
+        return OutTime > 0.0f;
+    };
     
-    // 포인트 간 거리가 최소값 이상일 때만 그리기 (너무 조밀한 점은 건너뜀)
-    float MinDistance = 2.5f;
-    TArray<FVector> FilteredPoints;
-    FilteredPoints.Add(Points[0]);
+    auto Evaluate = [&](float Time)
+    {
+        return Start + Velocity * Time + FVector(0.0f, 0.0f, 0.5f * GravityZ * Time * Time);
+    };
     
-    for (int32 i = 1; i < Points.Num(); i++)
+    // 1) 접시 윗면과의 교점 (구 중심 기준이므로 반지름만큼 올린 평면)
+    const float SurfaceHeight = Disc.Center.Z + ProbeRadius;
+    float Time = 0.0f;
+    if (Disc.bValid && SolveDescending(SurfaceHeight, Time) && Time <= TrajectoryMaxSimTime)
     {
-        float DistToLast = FVector::Dist(Points[i], FilteredPoints.Last());
-        if (DistToLast >= MinDistance || i == Points.Num() - 1) // 첫점과 끝점은 항상 포함
+        const FVector Landing = Evaluate(Time);
+        if (FVector::DistSquared2D(Landing, Disc.Center) <= FMath::Square(Disc.Radius))
         {
-            FilteredPoints.Add(Points[i]);
+            OutFlightTime = Time;
+            OutEnd = Landing;
+            return true;
         }
     }
     
-    // LineBatcher를 사용하여 궤적 그리기
-    for (int32 i = 0; i < FilteredPoints.Num() - 1; i++)
+    // 2) 접시를 벗어남 - 윗면 아래 MissDropHeight까지 (또는 최대 예측 시간까지)
+    if (!SolveDescending(SurfaceHeight - MissDropHeight, Time) || Time > TrajectoryMaxSimTime)
     {
-        // 지속 시간은 요청대로 100000.f 유지
-        CustomLineBatcher->DrawLine(
-            FilteredPoints[i], 
-            FilteredPoints[i + 1], 
-            PathColor, 
-            SDPG_World,
-            LineThickness, 
-            100000.f // 영구적
-        );
+        Time = TrajectoryMaxSimTime;
     }
+    OutFlightTime = Time;
+    OutEnd = Evaluate(Time);
+    return false;
 }
 
-// 이 함수는 FruitPhysicsHelper에서 이동됨
-TArray<FVector> UFruitTrajectoryHelper::CalculateTrajectoryPoints(UWorld* World, const FVector& StartLocation, const FVector& TargetLocation, float ThrowAngle, float BallMass)
+void UFruitTrajectoryHelper::CalculateAnalyticTrajectoryPoints(const FFruitPlateDisc& Disc, const FVector& Start, const FVector& Velocity, float GravityZ, TArray<FVector>& OutPoints)
 {
-    TArray<FVector> TrajectoryPoints;
+    float FlightTime = 0.0f;
+    FVector EndPoint;
+    SolveLanding(Start, Velocity, GravityZ, Disc, TrajectoryProbeRadius, FlightTime, EndPoint);
     
-    if (!World)
-        return TrajectoryPoints;
-    
-    // 물리 계산 결과 사용
-    FThrowPhysicsResult PhysicsResult = UFruitPhysicsHelper::CalculateThrowPhysics(
-        World, StartLocation, TargetLocation, ThrowAngle, BallMass);
+    // 포물선을 dt 간격 선분으로 나눌 때 최대 오차는 |g|*dt^2/8 이므로,
+    // 오차 기준을 만족하는 dt로 비행 시간을 나눠 샘플 수 결정 (짧은 궤적은 적게, 긴 궤적은 많게)
+    const float MaxStep = FMath::Sqrt(8.0f * TrajectoryChordTolerance / FMath::Max(FMath::Abs(GravityZ), 1.0f));
+    const int32 NumSegments = FMath::Clamp(FMath::CeilToInt(FlightTime / MaxStep), TrajectoryMinSegments, TrajectoryMaxSegments);
+    const float Step = FlightTime / NumSegments;
     
+    OutPoints.Reset(NumSegments + 1);
+    for (int32 i = 0; i < NumSegments; i++)
+    {
+        const float Time = Step * i;
+        OutPoints.Add(Start + Velocity * Time + FVector(0.0f, 0.0f, 0.5f * GravityZ * Time * Time));
+    }
+    OutPoints.Add(EndPoint);
+}
+
+void UFruitTrajectoryHelper::TraceTrajectoryPoints(UWorld* World, const FVector& Start, const FVector& Velocity, float GravityZ, TArray<FVector>& OutPoints)
+{
     // 가상의 물리 바디 생성 (시각적으로 표시하지 않고 예측용으로만 사용)
     FPredictProjectilePathParams PredictParams;
-    PredictParams.StartLocation = StartLocation;
-    PredictParams.LaunchVelocity = PhysicsResult.LaunchVelocity;
+    PredictParams.StartLocation = Start;
+    PredictParams.LaunchVelocity = Velocity;
     PredictParams.bTraceWithCollision = true;
-    PredictParams.ProjectileRadius = 5.0f;
-    PredictParams.MaxSimTime = 5.0f;
+    PredictParams.ProjectileRadius = TrajectoryProbeRadius;
+    PredictParams.MaxSimTime = TrajectoryMaxSimTime;
     PredictParams.SimFrequency = 20;
-    PredictParams.OverrideGravityZ = -FMath::Abs(GetDefault<UPhysicsSettings>()->DefaultGravityZ);
+    PredictParams.OverrideGravityZ = GravityZ;
     PredictParams.DrawDebugType = EDrawDebugTrace::None;
     
-    // 중요: 충돌 채널 설정 - WorldStatic만 검사하고 물체(FruitBall)은 무시
-    PredictParams.TraceChannel = ECC_WorldStatic;
-    
-    // 중요: 과일 공 무시 설정 추가
-    PredictParams.ActorsToIgnore.Empty();
-    
-    // 모든 FruitBall 찾아서 무시 목록에 추가
-    TArray<AActor*> FruitBalls;
-    UGameplayStatics::GetAllActorsOfClass(World, AFruitBall::StaticClass(), FruitBalls);
-    PredictParams.ActorsToIgnore = FruitBalls;
-    
-    // 접시는 충돌 테스트에 포함 (접시에 도달하는지 보여주기 위해)
-    TArray<AActor*> PlateActors;
-    UGameplayStatics::GetAllActorsWithTag(World, FName("Plate"), PlateActors);
-    if (PlateActors.Num() > 0)
-    {
-        // 이미 무시 목록에 있으면 제거
-        PredictParams.ActorsToIgnore.Remove(PlateActors[0]);
-    }
+    // 중요: 궤적 예측 전용 채널 - 과일은 채널 응답(Ignore)으로 빠지므로 무시 목록 없이 과일 수와 무관한 비용
+    PredictParams.TraceChannel = ECC_FruitPreview;
     
     FPredictProjectilePathResult PredictResult;
-    bool bHit = UGameplayStatics::PredictProjectilePath(World, PredictParams, PredictResult);
+    UGameplayStatics::PredictProjectilePath(World, PredictParams, PredictResult);
     
     // 예측 결과를 궤적 포인트로 변환
+    OutPoints.Reset(PredictResult.PathData.Num());
     for (const FPredictProjectilePathPointData& PointData : PredictResult.PathData)
     {
-        TrajectoryPoints.Add(PointData.Location);
+        OutPoints.Add(PointData.Location);
     }
-    
-    return TrajectoryPoints;
 }
 
 // 벡터 좌표 반올림 헬퍼 함수 추가
@@ -195,20 +251,101 @@ FVector UFruitTrajectoryHelper::RoundVector(const FVector& InVector, int32 Decim
 }
 
 // 궤적 시스템 초기화 함수 추가
-void UFruitTrajectoryHelper::ResetTrajectorySystem()
+void UFruitTrajectoryHelper::ResetTrajectorySystem(UWorld* World)
 {
-    // 라인 배처 사용중인 액터 정리
-    if (CustomLineBatcher && CustomLineBatcher->IsValidLowLevel())
+    // 궤적 숨기기 (컴포넌트는 폰과 함께 정리됨)
+    if (UFruitTrajectoryRenderComponent* RenderComponent = FindRenderComponent(World))
     {
-        if (AActor* OwnerActor = CustomLineBatcher->GetOwner())
+        RenderComponent->ClearTrajectory();
+    }
+    
+    UE_LOG(LogTemp, Verbose, TEXT("궤적 시각화 시스템 초기화 완료"));
+}
+
+// 궤적 계산 벤치마크 - 접시 둘레 스폰 위치 x 던지기 각도 조합마다 충돌 트레이스와 해석적 계산 비교
+// 사용법: Fruit.Bench.Trajectory [반복 횟수]
+static void RunTrajectoryBenchmark(const TArray<FString>& Args, UWorld* World)
+{
+    if (!World)
+    {
+        return;
+    }
+    
+    const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 20;
+    const FFruitPlateDisc& Disc = UFruitTrajectoryHelper::GetPlateDisc(World);
+    if (!Disc.bValid)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[Fruit.Bench.Trajectory] 접시를 찾을 수 없습니다."));
+        return;
+    }
+    
+    const float GravityZ = -FMath::Abs(GetDefault<UPhysicsSettings>()->DefaultGravityZ);
+    const float BallMass = UFruitSpawnHelper::CalculateBallMass(1);
+    
+    // 입력 조합별 발사 속도 (측정 대상 아님)
+    TArray<FVector> Starts;
+    TArray<FVector> Velocities;
+    for (float CameraAngle = 0.0f; CameraAngle < 360.0f; CameraAngle += 45.0f)
+    {
+        const FVector Start = UFruitSpawnHelper::CalculatePlateEdgeSpawnPosition(World, CameraAngle);
+        for (float ThrowAngle = UFruitPhysicsHelper::MinThrowAngle; ThrowAngle <= UFruitPhysicsHelper::MaxThrowAngle; ThrowAngle += 7.5f)
+        {
+            Starts.Add(Start);
+            Velocities.Add(UFruitPhysicsHelper::CalculateThrowPhysics(World, Start, Disc.Center, ThrowAngle, BallMass).LaunchVelocity);
+        }
+    }
+    
+    TArray<FVector> TracePoints;
+    TArray<FVector> AnalyticPoints;
+    float MaxError = 0.0f;
+    float SumError = 0.0f;
+    int32 NumCompared = 0;
+    
+    const double TraceStart = FPlatformTime::Seconds();
+    for (int32 Iter = 0; Iter < Iterations; Iter++)
+    {
+        for (int32 i = 0; i < Starts.Num(); i++)
         {
-            UE_LOG(LogTemp, Warning, TEXT("궤적 라인 배처 소유 액터 제거: %s"), *OwnerActor->GetName());
-            OwnerActor->Destroy();
+            UFruitTrajectoryHelper::TraceTrajectoryPoints(World, Starts[i], Velocities[i], GravityZ, TracePoints);
+        }
+    }
+    const double TraceUs = (FPlatformTime::Seconds() - TraceStart) * 1000000.0 / (Iterations * Starts.Num());
+    
+    const double AnalyticStart = FPlatformTime::Seconds();
+    for (int32 Iter = 0; Iter < Iterations; Iter++)
+    {
+        for (int32 i = 0; i < Starts.Num(); i++)
+        {
+            UFruitTrajectoryHelper::CalculateAnalyticTrajectoryPoints(Disc, Starts[i], Velocities[i], GravityZ, AnalyticPoints);
+        }
+    }
+    const double AnalyticUs = (FPlatformTime::Seconds() - AnalyticStart) * 1000000.0 / (Iterations * Starts.Num());
+    
+    // 끝점 오차 (접시에 떨어지는 궤적만 비교 - 벗어난 궤적은 트레이스가 바닥/테이블에 닿는 위치가 달라 의미 없음)
+    for (int32 i = 0; i < Starts.Num(); i++)
+    {
+        float FlightTime = 0.0f;
+        FVector AnalyticEnd;
+        if (!UFruitTrajectoryHelper::SolveLanding(Starts[i], Velocities[i], GravityZ, Disc, UFruitTrajectoryHelper::TrajectoryProbeRadius, FlightTime, AnalyticEnd))
+        {
+            continue;
         }
         
-        // 중요: 컴포넌트 참조를 null로 설정
-        CustomLineBatcher = nullptr;
+        UFruitTrajectoryHelper::TraceTrajectoryPoints(World, Starts[i], Velocities[i], GravityZ, TracePoints);
+        if (TracePoints.Num() == 0) continue;
+        
+        const float Error = FVector::Dist(TracePoints.Last(), AnalyticEnd);
+        MaxError = FMath::Max(MaxError, Error);
+        SumError += Error;
+        NumCompared++;
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("궤적 시각화 시스템 초기화 완료"));
-}
\ No newline at end of file
+    UE_LOG(LogTemp, Display, TEXT("[Fruit.Bench.Trajectory] 조합 %d개 x %d회: 충돌 트레이스 %.2f us/회 | 해석적 %.2f us/회 (%.1f배) | 끝점 오차 평균 %.2f cm, 최대 %.2f cm (접시 착지 %d개)"),
+        Starts.Num(), Iterations, TraceUs, AnalyticUs, AnalyticUs > 0.0 ? TraceUs / AnalyticUs : 0.0,
+        NumCompared > 0 ? SumError / NumCompared : 0.0f, MaxError, NumCompared);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs TrajectoryBenchmarkCommand(
+    TEXT("Fruit.Bench.Trajectory"),
+    TEXT("궤적 계산 비용과 끝점 오차 측정 (충돌 트레이스 vs 해석적). 인자: [반복 횟수]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunTrajectoryBenchmark));
\ No newline at end of file
@@ -2,35 +2,67 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "FruitPhysicsHelper.h"
 #include "FruitTrajectoryHelper.generated.h"
 
+struct FFruitPileContact;
+
 UCLASS()
 class UE_FRUITMOUNTAIN_API UFruitTrajectoryHelper : public UBlueprintFunctionLibrary
 {
     GENERATED_BODY()
 
 public:
-    // 궤적 업데이트 함수
+    // 궤적 업데이트 함수 (현재 입력 상태의 던지기 해에 담긴 궤적을 그림)
     UFUNCTION(BlueprintCallable, Category = "Trajectory")
-    static void UpdateTrajectoryPath(class AFruitPlayerController* Controller, const FVector& StartLocation, bool bPersistent = true, int32 CustomTrajectoryID = 9999);
+    static void UpdateTrajectoryPath(class AFruitPlayerController* Controller, bool bPersistent = true, int32 CustomTrajectoryID = 9999);
 
     // 궤적 시각화 함수 - 공용으로 변경
     UFUNCTION(BlueprintCallable, Category = "Trajectory")
     static void DrawTrajectoryPath(UWorld* World, const TArray<FVector>& Points, int32 TrajectoryID);
 
-    // 궤적 포인트 계산 함수
+    // 궤적 포인트 계산 함수 (이미 계산된 물리 결과의 발사 속도 사용)
     UFUNCTION(BlueprintCallable, Category = "Trajectory")
-    static TArray<FVector> CalculateTrajectoryPoints(UWorld* World, const FVector& StartLocation, const FVector& TargetLocation, float ThrowAngle, float BallMass);
+    static TArray<FVector> CalculateTrajectoryPoints(UWorld* World, const FVector& StartLocation, const FThrowPhysicsResult& PhysicsResult);
 
-    // 궤적 시각화 시스템 초기화 함수 추가
-    static void ResetTrajectorySystem();
+    // 궤적 시각화 시스템 초기화 함수 추가 (궤적 숨기고 캐시 정리)
+    static void ResetTrajectorySystem(UWorld* World);
+
+    // 충돌 트레이스로 궤적을 구할지 여부 (Fruit.Trajectory.TraceCollision, 기본은 해석적 계산)
+    static bool IsCollisionTraceEnabled();
+
+    // 과일 더미 충돌 예측 사용 여부 (Fruit.Trajectory.PileAware)
+    static bool IsPileAwareEnabled();
+
+    // 궤적과 착지한 과일 더미(구 집합)의 첫 접촉 - 물리 씬 트레이스 없음
+    static bool FindPileContact(UWorld* World, TConstArrayView<FVector> Points, float ProbeRadius, FFruitPileContact& OutContact);
+
+    // 접시 윗면 원판 (UFruitPlateSubsystem의 접시 모양)
+    static const FFruitPlateDisc& GetPlateDisc(UWorld* World);
+
+    // 포물선과 접시 윗면(반지름 ProbeRadius 구 기준)의 교점 계산
+    // 원판 안에 떨어지면 true, 벗어나면 윗면 아래 MissDropHeight까지 떨어진 지점을 OutEnd로 반환
+    static bool SolveLanding(const FVector& Start, const FVector& Velocity, float GravityZ, const FFruitPlateDisc& Disc, float ProbeRadius, float& OutFlightTime, FVector& OutEnd);
+
+    // 해석적 궤적 포인트 (착지 시간까지 오차 기준으로 샘플 수 결정)
+    static void CalculateAnalyticTrajectoryPoints(const FFruitPlateDisc& Disc, const FVector& Start, const FVector& Velocity, float GravityZ, TArray<FVector>& OutPoints);
+
+    // 충돌 트레이스 궤적 포인트 (기존 PredictProjectilePath 방식)
+    static void TraceTrajectoryPoints(UWorld* World, const FVector& Start, const FVector& Velocity, float GravityZ, TArray<FVector>& OutPoints);
+
+    // 궤적 예측 구 반지름 (과일 반경)
+    static constexpr float TrajectoryProbeRadius = 5.0f;
+
+    // 최대 예측 시간
+    static constexpr float TrajectoryMaxSimTime = 5.0f;
+
+    // 접시를 벗어난 궤적을 끝낼 높이 (윗면 기준 아래로)
+    static constexpr float MissDropHeight = 100.0f;
 
-private:
     // 벡터 좌표를 지정된 소수점 자리로 반올림하는 유틸리티 함수
     static FVector RoundVector(const FVector& InVector, int32 DecimalPlaces);
 
-    // 언리얼 엔진에서 정적 변수는 PIE 모드 간에 공유, "Object is not in global object array"
-    // 오류는 주로 이전 PIE 세션의 객체 참조 (ULineBatchComponent라는 정적 변수)
-    // 앞으로 정적 변수는 명시적 초기화/정리 패턴을 적용
-    static ULineBatchComponent* CustomLineBatcher;
+private:
+    // 궤적을 그릴 렌더 컴포넌트 (플레이어 폰 소유)
+    static class UFruitTrajectoryRenderComponent* FindRenderComponent(UWorld* World);
 };
\ No newline at end of file
@@ -0,0 +1,311 @@
+#include "FruitTrajectoryRenderComponent.h"
+#include "PrimitiveSceneProxy.h"
+#include "SceneManagement.h"
+#include "RenderingThread.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_CYCLE_STAT(TEXT("Trajectory Draw"), STAT_FruitTrajectoryDraw, STATGROUP_FruitMountain);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Trajectory Vertices Uploaded"), STAT_FruitTrajectoryVerticesUploaded, STATGROUP_FruitMountain);
+
+// 이 거리 이내로 움직인 정점은 바뀌지 않은 것으로 봄
+static constexpr float VertexChangeTolerance = 0.01f;
+
+// 접촉 지점 구의 둘레 분할 수
+static constexpr int32 ContactSphereSides = 12;
+
+// 궤적 씬 프록시 - 렌더 스레드 쪽 정점 사본을 선으로 그림
+class FFruitTrajectorySceneProxy final : public FPrimitiveSceneProxy
+{
+public:
+    using FVertexArray = UFruitTrajectoryRenderComponent::FVertexArray;
+
+    FFruitTrajectorySceneProxy(const UFruitTrajectoryRenderComponent* InComponent)
+        : FPrimitiveSceneProxy(InComponent)
+        , Vertices(InComponent->GetVertices())
+        , PathColor(InComponent->PathColor)
+        , LineThickness(InComponent->LineThickness)
+        , ContactColor(InComponent->ContactColor)
+        , bHasContact(InComponent->HasContactPoint())
+        , ContactLocation(InComponent->GetContactLocation())
+        , ContactRadius(InComponent->GetContactRadius())
+    {
+    }
+
+    virtual SIZE_T GetTypeHash() const override
+    {
+        static size_t UniquePointer;
+        return reinterpret_cast<size_t>(&UniquePointer);
+    }
+
+    // FirstDirty 이전 정점은 그대로 두고 나머지만 복사
+    void UpdateVertices_RenderThread(int32 FirstDirty, const FVertexArray& NewVertices)
+    {
+        check(IsInRenderingThread());
+
+        Vertices.SetNumUninitialized(NewVertices.Num());
+        for (int32 i = FirstDirty; i < NewVertices.Num(); i++)
+        {
+            Vertices[i] = NewVertices[i];
+        }
+    }
+
+    void UpdateContact_RenderThread(bool bInHasContact, const FVector& InLocation, float InRadius)
+    {
+        check(IsInRenderingThread());
+
+        bHasContact = bInHasContact;
+        ContactLocation = InLocation;
+        ContactRadius = InRadius;
+    }
+
+    virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override
+    {
+        if (Vertices.Num() < 2 && !bHasContact)
+        {
+            return;
+        }
+
+        for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
+        {
+            if (!(VisibilityMap & (1 << ViewIndex)))
+            {
+                continue;
+            }
+
+            FPrimitiveDrawInterface* PDI = Collector.GetPDI(ViewIndex);
+            for (int32 i = 0; i < Vertices.Num() - 1; i++)
+            {
+                PDI->DrawLine(Vertices[i], Vertices[i + 1], PathColor, SDPG_World, LineThickness);
+            }
+
+            if (bHasContact)
+            {
+                DrawWireSphere(PDI, ContactLocation, ContactColor, ContactRadius, ContactSphereSides, SDPG_World, LineThickness);
+            }
+        }
+    }
+
+    virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override
+    {
+        FPrimitiveViewRelevance Result;
+        Result.bDrawRelevance = IsShown(View);
+        Result.bDynamicRelevance = true;
+        Result.bShadowRelevance = false;
+        Result.bEditorPrimitiveRelevance = UseEditorCompositing(View);
+        return Result;
+    }
+
+    virtual uint32 GetMemoryFootprint() const override
+    {
+        return sizeof(*this) + GetAllocatedSize();
+    }
+
+private:
+    FVertexArray Vertices;
+    FLinearColor PathColor;
+    float LineThickness;
+
+    FLinearColor ContactColor;
+    bool bHasContact;
+    FVector ContactLocation;
+    float ContactRadius;
+};
+
+UFruitTrajectoryRenderComponent::UFruitTrajectoryRenderComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+
+    // 순수 시각화용 - 충돌/그림자 없음
+    SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    SetGenerateOverlapEvents(false);
+    CastShadow = false;
+    bSelectable = false;
+
+    // 정점이 월드 좌표이므로 부모(카메라 폰) 이동의 영향을 받지 않도록 절대 트랜스폼 사용
+    SetUsingAbsoluteLocation(true);
+    SetUsingAbsoluteRotation(true);
+    SetUsingAbsoluteScale(true);
+}
+
+FPrimitiveSceneProxy* UFruitTrajectoryRenderComponent::CreateSceneProxy()
+{
+    return new FFruitTrajectorySceneProxy(this);
+}
+
+FBoxSphereBounds UFruitTrajectoryRenderComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+    if (Vertices.Num() == 0)
+    {
+        return FBoxSphereBounds(LocalToWorld.GetLocation(), FVector::ZeroVector, 0.0f);
+    }
+
+    FBox Box(Vertices.GetData(), Vertices.Num());
+    if (bHasContact)
+    {
+        Box += FBox::BuildAABB(ContactLocation, FVector(ContactRadius));
+    }
+    return FBoxSphereBounds(Box.ExpandBy(LineThickness));
+}
+
+void UFruitTrajectoryRenderComponent::DecimatePoints(const TArray<FVector>& Points, FVertexArray& OutVertices) const
+{
+    OutVertices.Reset();
+    if (Points.Num() < 2)
+    {
+        return;
+    }
+
+    const float CosThreshold = FMath::Cos(FMath::DegreesToRadians(DecimationAngle));
+    const float MinSegmentLengthSquared = FMath::Square(MinSegmentLength);
+
+    // 첫 점은 항상 남김
+    OutVertices.Add(Points[0]);
+    FVector KeptDirection = (Points[1] - Points[0]).GetSafeNormal();
+
+    // 마지막으로 남긴 점 이후 진행 방향이 충분히 꺾인 점만 남김 (끝점 자리는 비워 둠)
+    for (int32 i = 1; i < Points.Num() - 1 && OutVertices.Num() < MaxVertices - 1; i++)
+    {
+        const FVector Direction = (Points[i + 1] - Points[i]).GetSafeNormal();
+        if (FVector::DotProduct(Direction, KeptDirection) < CosThreshold &&
+            FVector::DistSquared(Points[i], OutVertices.Last()) >= MinSegmentLengthSquared)
+        {
+            OutVertices.Add(Points[i]);
+            KeptDirection = Direction;
+        }
+    }
+
+    // 끝점은 항상 남김
+    OutVertices.Add(Points.Last());
+}
+
+void UFruitTrajectoryRenderComponent::SetClippedTrajectory(const TArray<FVector>& Points, int32 NumPoints, const FVector& EndPoint)
+{
+    NumPoints = FMath::Clamp(NumPoints, 0, Points.Num());
+
+    ClippedPoints.Reset(NumPoints + 1);
+    ClippedPoints.Append(Points.GetData(), NumPoints);
+    ClippedPoints.Add(EndPoint);
+
+    SetTrajectory(ClippedPoints);
+}
+
+void UFruitTrajectoryRenderComponent::SetTrajectory(const TArray<FVector>& Points)
+{
+    SCOPE_CYCLE_COUNTER(STAT_FruitTrajectoryDraw);
+
+    DecimatePoints(Points, ScratchVertices);
+
+    // 이전 궤적과 처음 달라지는 정점 찾기
+    const int32 NumCommon = FMath::Min(ScratchVertices.Num(), Vertices.Num());
+    int32 FirstDirty = 0;
+    while (FirstDirty < NumCommon && ScratchVertices[FirstDirty].Equals(Vertices[FirstDirty], VertexChangeTolerance))
+    {
+        FirstDirty++;
+    }
+
+    if (FirstDirty == ScratchVertices.Num() && ScratchVertices.Num() == Vertices.Num())
+    {
+        // 바뀐 것 없음
+        return;
+    }
+
+    Vertices = ScratchVertices;
+    INC_DWORD_STAT_BY(STAT_FruitTrajectoryVerticesUploaded, Vertices.Num() - FirstDirty);
+
+    // 궤적이 현재 바운드를 벗어날 때만 바운드 갱신
+    const FBox NewBox = Vertices.Num() > 0 ? FBox(Vertices.GetData(), Vertices.Num()).ExpandBy(LineThickness) : FBox(ForceInit);
+    if (NewBox.IsValid && !Bounds.GetBox().IsInside(NewBox))
+    {
+        UpdateBounds();
+        MarkRenderTransformDirty();
+    }
+
+    if (!SceneProxy)
+    {
+        MarkRenderStateDirty();
+        return;
+    }
+
+    // 바뀐 구간만 렌더 스레드 사본에 반영
+    FFruitTrajectorySceneProxy* TrajectoryProxy = static_cast<FFruitTrajectorySceneProxy*>(SceneProxy);
+    ENQUEUE_RENDER_COMMAND(UpdateFruitTrajectoryVertices)(
+        [TrajectoryProxy, FirstDirty, NewVertices = Vertices](FRHICommandListImmediate& RHICmdList)
+        {
+            TrajectoryProxy->UpdateVertices_RenderThread(FirstDirty, NewVertices);
+        });
+}
+
+void UFruitTrajectoryRenderComponent::ClearTrajectory()
+{
+    ClearContactPoint();
+
+    ScratchVertices.Reset();
+    if (Vertices.Num() == 0)
+    {
+        return;
+    }
+
+    Vertices.Reset();
+
+    if (SceneProxy)
+    {
+        FFruitTrajectorySceneProxy* TrajectoryProxy = static_cast<FFruitTrajectorySceneProxy*>(SceneProxy);
+        ENQUEUE_RENDER_COMMAND(ClearFruitTrajectoryVertices)(
+            [TrajectoryProxy](FRHICommandListImmediate& RHICmdList)
+            {
+                TrajectoryProxy->UpdateVertices_RenderThread(0, FVertexArray());
+            });
+    }
+}
+
+void UFruitTrajectoryRenderComponent::SetContactPoint(const FVector& Location, float Radius)
+{
+    if (bHasContact && ContactLocation.Equals(Location, VertexChangeTolerance) && FMath::IsNearlyEqual(ContactRadius, Radius))
+    {
+        return;
+    }
+
+    bHasContact = true;
+    ContactLocation = Location;
+    ContactRadius = Radius;
+
+    // 접촉 구가 현재 바운드를 벗어날 때만 바운드 갱신
+    if (!Bounds.GetBox().IsInside(FBox::BuildAABB(Location, FVector(Radius + LineThickness))))
+    {
+        UpdateBounds();
+        MarkRenderTransformDirty();
+    }
+
+    if (!SceneProxy)
+    {
+        MarkRenderStateDirty();
+        return;
+    }
+
+    FFruitTrajectorySceneProxy* TrajectoryProxy = static_cast<FFruitTrajectorySceneProxy*>(SceneProxy);
+    ENQUEUE_RENDER_COMMAND(UpdateFruitTrajectoryContact)(
+        [TrajectoryProxy, Location, Radius](FRHICommandListImmediate& RHICmdList)
+        {
+            TrajectoryProxy->UpdateContact_RenderThread(true, Location, Radius);
+        });
+}
+
+void UFruitTrajectoryRenderComponent::ClearContactPoint()
+{
+    if (!bHasContact)
+    {
+        return;
+    }
+
+    bHasContact = false;
+
+    if (SceneProxy)
+    {
+        FFruitTrajectorySceneProxy* TrajectoryProxy = static_cast<FFruitTrajectorySceneProxy*>(SceneProxy);
+        ENQUEUE_RENDER_COMMAND(ClearFruitTrajectoryContact)(
+            [TrajectoryProxy](FRHICommandListImmediate& RHICmdList)
+            {
+                TrajectoryProxy->UpdateContact_RenderThread(false, FVector::ZeroVector, 0.0f);
+            });
+    }
+}
\ No newline at end of file
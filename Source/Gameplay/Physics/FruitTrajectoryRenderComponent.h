@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/PrimitiveComponent.h"
+#include "FruitTrajectoryRenderComponent.generated.h"
+
+/**
+ * 궤적 미리보기 전용 렌더 컴포넌트
+ * 고정 크기 정점 버퍼를 유지하고, 이전 궤적과 달라진 정점부터만 렌더 스레드로 보냄
+ * 입력 포인트는 곡률 기준으로 솎아 냄 (곧은 구간은 적게, 많이 휘는 구간은 촘촘하게)
+ * 과일 더미와의 첫 접촉 지점은 날아가는 과일 크기의 구로 표시
+ * 정점은 월드 좌표 그대로 사용 (컴포넌트는 절대 트랜스폼으로 원점에 고정)
+ */
+UCLASS(ClassGroup = (Fruit), meta = (BlueprintSpawnableComponent))
+class UE_FRUITMOUNTAIN_API UFruitTrajectoryRenderComponent : public UPrimitiveComponent
+{
+    GENERATED_BODY()
+
+public:
+    UFruitTrajectoryRenderComponent();
+
+    // 정점 버퍼 최대 크기
+    static constexpr int32 MaxVertices = 64;
+
+    using FVertexArray = TArray<FVector, TFixedAllocator<MaxVertices>>;
+
+    // 궤적 갱신 - 솎아 낸 결과가 이전과 같으면 아무것도 하지 않음
+    void SetTrajectory(const TArray<FVector>& Points);
+
+    // 앞쪽 NumPoints개 포인트 뒤에 EndPoint를 이어 붙인 궤적으로 갱신 (과일 더미 접촉 지점에서 자른 궤적)
+    void SetClippedTrajectory(const TArray<FVector>& Points, int32 NumPoints, const FVector& EndPoint);
+
+    // 궤적 숨기기
+    void ClearTrajectory();
+
+    // 첫 접촉 지점 표시 (접촉 순간 날아가는 과일의 중심과 반지름) - 이전과 같으면 아무것도 하지 않음
+    void SetContactPoint(const FVector& Location, float Radius);
+
+    // 접촉 지점 숨기기
+    void ClearContactPoint();
+
+    const FVertexArray& GetVertices() const { return Vertices; }
+
+    bool HasContactPoint() const { return bHasContact; }
+    const FVector& GetContactLocation() const { return ContactLocation; }
+    float GetContactRadius() const { return ContactRadius; }
+
+    // 선 색상
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory")
+    FColor PathColor = FColor(135, 206, 235, 255);
+
+    // 선 두께
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory")
+    float LineThickness = 0.8f;
+
+    // 접촉 지점 색상
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory")
+    FColor ContactColor = FColor(255, 140, 0, 255);
+
+    // 진행 방향이 이 각도(도) 이상 꺾여야 점을 남김
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory")
+    float DecimationAngle = 3.0f;
+
+    // 남기는 점 사이 최소 거리
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trajectory")
+    float MinSegmentLength = 2.5f;
+
+    //~ Begin UPrimitiveComponent Interface
+    virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
+    virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+    //~ End UPrimitiveComponent Interface
+
+private:
+    // 곡률 기준 점 솎아 내기 (OutVertices는 고정 크기 배열이라 힙 할당 없음)
+    void DecimatePoints(const TArray<FVector>& Points, FVertexArray& OutVertices) const;
+
+    // 현재 그리고 있는 정점 (게임 스레드 사본)
+    FVertexArray Vertices;
+
+    // 솎아 내기 결과 임시 버퍼
+    FVertexArray ScratchVertices;
+
+    // 접촉 지점에서 자른 궤적 임시 버퍼
+    TArray<FVector> ClippedPoints;
+
+    // 첫 접촉 지점 (게임 스레드 사본)
+    bool bHasContact = false;
+    FVector ContactLocation = FVector::ZeroVector;
+    float ContactRadius = 0.0f;
+};
\ No newline at end of file
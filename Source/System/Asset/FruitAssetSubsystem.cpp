@@ -0,0 +1,174 @@
+#include "FruitAssetSubsystem.h"
+#include "Actors/FruitBall.h"
+#include "Gameplay/Fruit/FruitTypeCatalog.h"
+#include "Gameplay/Physics/FruitThrowTable.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "Sound/SoundBase.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "UE_FruitMountain.h"
+
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Startup To Assets Ready (ms)"), STAT_FruitStartupToAssetsReady, STATGROUP_FruitMountain);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Startup To First Throw (ms)"), STAT_FruitStartupToFirstThrow, STATGROUP_FruitMountain);
+
+void UFruitAssetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    StartupTime = FPlatformTime::Seconds();
+
+    // 카탈로그 에셋이 없으면 기본값(기존 계산식) 사용
+    TypeCatalog = TSoftObjectPtr<UFruitTypeCatalog>(FSoftObjectPath(TEXT("/Game/Fruit/DA_FruitTypeCatalog.DA_FruitTypeCatalog")));
+    MergeEffectClass = TSoftClassPtr<AActor>(FSoftObjectPath(TEXT("/Game/Particle/02_Blueprints/BP_Particle_Burst_Lvl_1.BP_Particle_Burst_Lvl_1_C")));
+    MergeSound = TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Sounds/S_FruitMerge.S_FruitMerge")));
+
+    // 던지기 테이블이 없으면 솔버로 계산 (-run=FruitThrowTableBake 커맨드릿으로 생성)
+    ThrowTable = TSoftObjectPtr<UFruitThrowTable>(FSoftObjectPath(TEXT("/Game/Fruit/DA_FruitThrowTable.DA_FruitThrowTable")));
+
+    StartAsyncLoad();
+}
+
+void UFruitAssetSubsystem::Deinitialize()
+{
+    if (CatalogHandle.IsValid())
+    {
+        CatalogHandle->CancelHandle();
+        CatalogHandle.Reset();
+    }
+
+    // 타입 테이블은 다른 게임 인스턴스(PIE)와 공유하므로 건드리지 않음 - 메시는 약한 참조라 핸들을 놓아도 안전
+    if (LoadHandle.IsValid())
+    {
+        LoadHandle->CancelHandle();
+        LoadHandle.Reset();
+    }
+
+    OnAssetsReady.Clear();
+
+    Super::Deinitialize();
+}
+
+UFruitAssetSubsystem* UFruitAssetSubsystem::Get(const UObject* WorldContextObject)
+{
+    UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject);
+    return GameInstance ? GameInstance->GetSubsystem<UFruitAssetSubsystem>() : nullptr;
+}
+
+void UFruitAssetSubsystem::StartAsyncLoad()
+{
+    if (CatalogHandle.IsValid() || bAssetsReady)
+    {
+        return;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("과일 에셋 비동기 로드 시작"));
+
+    CatalogHandle = StreamableManager.RequestAsyncLoad(
+        TypeCatalog.ToSoftObjectPath(),
+        FStreamableDelegate::CreateUObject(this, &UFruitAssetSubsystem::HandleCatalogLoaded),
+        FStreamableManager::AsyncLoadHighPriority,
+        true);
+}
+
+void UFruitAssetSubsystem::HandleCatalogLoaded()
+{
+    const UFruitTypeCatalog* Catalog = TypeCatalog.Get();
+    if (!Catalog)
+    {
+        UE_LOG(LogTemp, Log, TEXT("과일 타입 카탈로그 에셋이 없어 기본값 사용"));
+        Catalog = GetDefault<UFruitTypeCatalog>();
+    }
+
+    FFruitTypeTable::Bake(Catalog);
+
+    TArray<FSoftObjectPath> AssetPaths;
+    FruitMeshes.SetNum(AFruitBall::MaxBallType + 1);
+    for (int32 BallType = 1; BallType <= AFruitBall::MaxBallType; BallType++)
+    {
+        FruitMeshes[BallType] = Catalog->Types.IsValidIndex(BallType - 1)
+            ? Catalog->Types[BallType - 1].Mesh
+            : UFruitTypeCatalog::MakeDefaultDefinition(BallType).Mesh;
+        AssetPaths.Add(FruitMeshes[BallType].ToSoftObjectPath());
+    }
+    AssetPaths.Add(MergeEffectClass.ToSoftObjectPath());
+    AssetPaths.Add(MergeSound.ToSoftObjectPath());
+    AssetPaths.Add(ThrowTable.ToSoftObjectPath());
+
+    // 로드된 에셋은 핸들이 유지되는 동안 GC되지 않음
+    LoadHandle = StreamableManager.RequestAsyncLoad(
+        AssetPaths,
+        FStreamableDelegate::CreateUObject(this, &UFruitAssetSubsystem::HandleAssetsLoaded),
+        FStreamableManager::AsyncLoadHighPriority,
+        true);
+}
+
+void UFruitAssetSubsystem::HandleAssetsLoaded()
+{
+    bAssetsReady = true;
+
+    for (int32 BallType = 1; BallType < FruitMeshes.Num(); BallType++)
+    {
+        FFruitTypeTable::SetMesh(BallType, FruitMeshes[BallType].Get());
+    }
+
+    // 질량이 해시에 들어가므로 카탈로그를 구운 뒤에 확인
+    if (const UFruitThrowTable* Table = ThrowTable.Get())
+    {
+        bThrowTableUpToDate = Table->IsUpToDate(FMath::Abs(GetDefault<UPhysicsSettings>()->DefaultGravityZ));
+        if (bThrowTableUpToDate)
+        {
+            UE_LOG(LogTemp, Display, TEXT("던지기 테이블 로드: 샘플 %d개"), Table->GetNumSamples());
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("던지기 테이블이 현재 솔버 상수와 맞지 않아 사용하지 않습니다. 다시 구워야 합니다 (-run=FruitThrowTableBake)."));
+        }
+    }
+
+    const float ElapsedMs = float((FPlatformTime::Seconds() - StartupTime) * 1000.0);
+    SET_FLOAT_STAT(STAT_FruitStartupToAssetsReady, ElapsedMs);
+    UE_LOG(LogTemp, Display, TEXT("과일 에셋 로드 완료: 시작 후 %.1f ms"), ElapsedMs);
+
+    // 로드 전에 만들어져 기본 메시를 쓰고 있던 과일 갱신
+    if (UWorld* World = GetGameInstance()->GetWorld())
+    {
+        for (TActorIterator<AFruitBall> It(World); It; ++It)
+        {
+            It->UpdateFruitMesh(It->GetBallType());
+        }
+    }
+
+    OnAssetsReady.Broadcast();
+}
+
+TSubclassOf<AActor> UFruitAssetSubsystem::GetMergeEffectClass() const
+{
+    return MergeEffectClass.Get();
+}
+
+USoundBase* UFruitAssetSubsystem::GetMergeSound() const
+{
+    return MergeSound.Get();
+}
+
+const UFruitThrowTable* UFruitAssetSubsystem::GetThrowTable() const
+{
+    return bThrowTableUpToDate ? ThrowTable.Get() : nullptr;
+}
+
+void UFruitAssetSubsystem::NotifyFirstThrow()
+{
+    if (bFirstThrowLogged)
+    {
+        return;
+    }
+    bFirstThrowLogged = true;
+
+    const float ElapsedMs = float((FPlatformTime::Seconds() - StartupTime) * 1000.0);
+    SET_FLOAT_STAT(STAT_FruitStartupToFirstThrow, ElapsedMs);
+    UE_LOG(LogTemp, Display, TEXT("첫 던지기: 시작 후 %.1f ms (에셋 로드 %s)"),
+        ElapsedMs, bAssetsReady ? TEXT("완료") : TEXT("진행 중"));
+}
\ No newline at end of file
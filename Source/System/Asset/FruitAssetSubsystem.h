@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "FruitAssetSubsystem.generated.h"
+
+class UStaticMesh;
+class USoundBase;
+class UFruitTypeCatalog;
+class UFruitThrowTable;
+
+/**
+ * 과일 관련 에셋(타입 카탈로그, 메시, 병합 이펙트, 병합 사운드, 던지기 테이블)을 소프트 참조로 들고 비동기로 스트리밍하는 서브시스템
+ * 게임 인스턴스 초기화 시 카탈로그 -> 나머지 에셋 순으로 로드하고, 로드가 끝나기 전에 요청된 에셋은 nullptr을 돌려줘 호출 측이 대체 처리
+ * 로드된 메시는 FFruitTypeTable에 연결됨
+ */
+UCLASS()
+class UE_FRUITMOUNTAIN_API UFruitAssetSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // 월드 컨텍스트로 서브시스템 찾기
+    static UFruitAssetSubsystem* Get(const UObject* WorldContextObject);
+
+    // 비동기 로드 시작 (이미 시작했으면 무시)
+    void StartAsyncLoad();
+
+    // 모든 에셋 로드 완료 여부
+    bool AreAssetsReady() const { return bAssetsReady; }
+
+    // 로드된 에셋 조회 - 아직 로드 중이면 nullptr (블로킹 없음)
+    TSubclassOf<AActor> GetMergeEffectClass() const;
+    USoundBase* GetMergeSound() const;
+
+    // 구워 둔 던지기 테이블 - 로드 전이거나 없거나 솔버 상수가 바뀌었으면 nullptr
+    const UFruitThrowTable* GetThrowTable() const;
+
+    // 첫 던지기 시점 기록 (시작부터 첫 던지기까지 시간 로그)
+    void NotifyFirstThrow();
+
+    // 모든 에셋 로드 완료 시 호출
+    FSimpleMulticastDelegate OnAssetsReady;
+
+private:
+    // 카탈로그 로드 후 테이블을 굽고 메시/이펙트/사운드 로드 요청
+    void HandleCatalogLoaded();
+    void HandleAssetsLoaded();
+
+    TSoftObjectPtr<UFruitTypeCatalog> TypeCatalog;
+
+    // 인덱스 = BallType (0은 사용하지 않음)
+    TArray<TSoftObjectPtr<UStaticMesh>> FruitMeshes;
+
+    TSoftClassPtr<AActor> MergeEffectClass;
+    TSoftObjectPtr<USoundBase> MergeSound;
+    TSoftObjectPtr<UFruitThrowTable> ThrowTable;
+
+    // 로드된 던지기 테이블이 현재 솔버 상수로 구운 것인지 (로드 완료 시 한 번 확인)
+    bool bThrowTableUpToDate = false;
+
+    FStreamableManager StreamableManager;
+    TSharedPtr<FStreamableHandle> CatalogHandle;
+    TSharedPtr<FStreamableHandle> LoadHandle;
+
+    // 시간 측정 (FPlatformTime::Seconds 기준)
+    double StartupTime = 0.0;
+    bool bAssetsReady = false;
+    bool bFirstThrowLogged = false;
+};
\ No newline at end of file
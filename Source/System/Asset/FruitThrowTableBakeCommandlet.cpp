@@ -0,0 +1,132 @@
+#include "FruitThrowTableBakeCommandlet.h"
+#include "Actors/PlateActor.h"
+#include "Gameplay/Fruit/FruitTypeCatalog.h"
+#include "Gameplay/Physics/FruitThrowHelper.h"
+#include "Gameplay/Physics/FruitThrowSolution.h"
+#include "Gameplay/Physics/FruitThrowTable.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+
+// 기본 입력 맵 / 출력 에셋 (게임이 로드하는 경로와 같아야 함)
+static const TCHAR* DefaultBakeMap = TEXT("/Game/Level/PlayLevel");
+static const TCHAR* DefaultBakeOutput = TEXT("/Game/Fruit/DA_FruitThrowTable");
+static const TCHAR* CatalogObjectPath = TEXT("/Game/Fruit/DA_FruitTypeCatalog.DA_FruitTypeCatalog");
+
+// 기본 샘플 간격 (도)과 궤적당 점 개수
+static constexpr float DefaultBakeAngleStep = 1.0f;
+static constexpr int32 DefaultBakePointsPerPath = 32;
+
+UFruitThrowTableBakeCommandlet::UFruitThrowTableBakeCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UFruitThrowTableBakeCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+    FString MapName = DefaultBakeMap;
+    FString OutputPackageName = DefaultBakeOutput;
+    float AngleStep = DefaultBakeAngleStep;
+    int32 PointsPerPath = DefaultBakePointsPerPath;
+    FParse::Value(*Params, TEXT("Map="), MapName);
+    FParse::Value(*Params, TEXT("Output="), OutputPackageName);
+    FParse::Value(*Params, TEXT("AngleStep="), AngleStep);
+    FParse::Value(*Params, TEXT("Points="), PointsPerPath);
+
+    // 질량은 솔버 버전 해시에 들어가므로 게임과 같은 카탈로그로 타입 테이블 구성
+    const UFruitTypeCatalog* Catalog = LoadObject<UFruitTypeCatalog>(nullptr, CatalogObjectPath);
+    FFruitTypeTable::Bake(Catalog ? Catalog : GetDefault<UFruitTypeCatalog>());
+
+    // 맵 로드 - 물리/오디오 없이 컴포넌트 바운드만 필요
+    UPackage* MapPackage = LoadPackage(nullptr, *MapName, LOAD_None);
+    UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+    if (!World)
+    {
+        UE_LOG(LogTemp, Error, TEXT("던지기 테이블 굽기: 맵을 불러올 수 없습니다 (%s)"), *MapName);
+        return 1;
+    }
+
+    World->AddToRoot();
+    World->WorldType = EWorldType::Editor;
+    World->InitWorld(UWorld::InitializationValues()
+        .CreatePhysicsScene(false)
+        .ShouldSimulatePhysics(false)
+        .EnableTraceCollision(false)
+        .CreateNavigation(false)
+        .CreateAISystem(false)
+        .AllowAudioPlayback(false));
+    World->UpdateWorldComponents(true, false);
+
+    auto ReleaseWorld = [World]()
+    {
+        World->RemoveFromRoot();
+        World->DestroyWorld(false);
+    };
+
+    // 게임 모드 StartPlay와 같이 접시가 없으면 원점에 기본 접시 생성
+    FVector PlateLocation;
+    if (!UFruitThrowHelper::FindPlateAimLocation(World, PlateLocation))
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        World->SpawnActor<APlateActor>(APlateActor::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+        UFruitThrowHelper::FindPlateAimLocation(World, PlateLocation);
+    }
+
+    FFruitThrowSolutionCache PlateFrame;
+    UFruitThrowHelper::RebuildPlateFrame(World, PlateLocation, PlateFrame);
+    if (!PlateFrame.bPlateFrameValid)
+    {
+        UE_LOG(LogTemp, Error, TEXT("던지기 테이블 굽기: 접시 기준 틀을 만들 수 없습니다 (%s)"), *MapName);
+        ReleaseWorld();
+        return 1;
+    }
+
+    FVector TargetLocation = PlateLocation;
+    TargetLocation.Z += UFruitThrowHelper::ThrowTargetHeightOffset;
+
+    // 기존 에셋이 있으면 덮어씀
+    const FString AssetName = FPackageName::GetLongPackageAssetName(OutputPackageName);
+    UPackage* Package = CreatePackage(*OutputPackageName);
+    Package->FullyLoad();
+
+    UFruitThrowTable* Table = FindObject<UFruitThrowTable>(Package, *AssetName);
+    if (!Table)
+    {
+        Table = NewObject<UFruitThrowTable>(Package, *AssetName, RF_Public | RF_Standalone);
+        FAssetRegistryModule::AssetCreated(Table);
+    }
+
+    const double BakeStart = FPlatformTime::Seconds();
+    Table->Bake(PlateFrame, TargetLocation, AngleStep, PointsPerPath);
+    const float BakeMs = float((FPlatformTime::Seconds() - BakeStart) * 1000.0);
+
+    UE_LOG(LogTemp, Display, TEXT("던지기 테이블 굽기: 샘플 %d개 (공 타입 %d x 각도 %d, 간격 %.2f도, 궤적 점 %d개), %.1f ms, 버전 0x%08x"),
+        Table->GetNumSamples(), Table->NumBallTypes, Table->NumAngles, Table->AngleStep, Table->PointsPerPath, BakeMs, Table->SolverVersion);
+    UE_LOG(LogTemp, Display, TEXT("던지기 테이블 굽기: 샘플 사이 보간 오차 최대 %.2f cm"),
+        Table->MeasureInterpolationError(PlateFrame, TargetLocation));
+
+    Package->MarkPackageDirty();
+
+    const FString FileName = FPackageName::LongPackageNameToFilename(OutputPackageName, FPackageName::GetAssetPackageExtension());
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+    const bool bSaved = UPackage::SavePackage(Package, Table, *FileName, SaveArgs);
+    if (!bSaved)
+    {
+        UE_LOG(LogTemp, Error, TEXT("던지기 테이블 굽기: 저장 실패 (%s)"), *FileName);
+    }
+
+    ReleaseWorld();
+    return bSaved ? 0 : 1;
+#else
+    UE_LOG(LogTemp, Error, TEXT("던지기 테이블 굽기는 에디터 빌드에서만 실행할 수 있습니다."));
+    return 1;
+#endif
+}
\ No newline at end of file
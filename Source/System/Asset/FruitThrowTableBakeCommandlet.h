@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FruitThrowTableBakeCommandlet.generated.h"
+
+/**
+ * 던지기 테이블(UFruitThrowTable) 굽기 커맨드릿 - 헤드리스 실행
+ * UnrealEditor-Cmd <프로젝트> -run=FruitThrowTableBake [-Map=/Game/Level/PlayLevel] [-Output=/Game/Fruit/DA_FruitThrowTable] [-AngleStep=1] [-Points=32]
+ * 맵을 불러와 게임과 같은 접시 기준 틀을 만들고, 모든 공 타입 x 각도 샘플을 에셋으로 저장
+ * 솔버 상수를 바꾼 뒤에는 다시 실행해야 함 (게임은 버전이 다른 테이블을 무시)
+ */
+UCLASS()
+class UE_FRUITMOUNTAIN_API UFruitThrowTableBakeCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UFruitThrowTableBakeCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
\ No newline at end of file
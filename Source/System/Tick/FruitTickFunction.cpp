@@ -0,0 +1,55 @@
+#include "FruitTickFunction.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+
+void FFruitTickFunction::Setup(UWorld* World, ETickingGroup InTickGroup, TFunction<void(float)>&& InFunction, const TCHAR* InDebugName)
+{
+    if (!World || !World->PersistentLevel)
+    {
+        return;
+    }
+
+    Teardown();
+
+    Function = MoveTemp(InFunction);
+    DebugName = FName(InDebugName);
+
+    bCanEverTick = true;
+    bStartWithTickEnabled = true;
+    bTickEvenWhenPaused = false;
+    TickGroup = InTickGroup;
+    EndTickGroup = InTickGroup;
+
+    RegisterTickFunction(World->PersistentLevel);
+}
+
+void FFruitTickFunction::Teardown()
+{
+    if (IsTickFunctionRegistered())
+    {
+        UnRegisterTickFunction();
+    }
+
+    Function.Reset();
+}
+
+void FFruitTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    // 에디터 뷰포트 전용 틱에서는 게임 로직을 돌리지 않음
+    if (TickType == LEVELTICK_ViewportsOnly || !Function)
+    {
+        return;
+    }
+
+    Function(DeltaTime);
+}
+
+FString FFruitTickFunction::DiagnosticMessage()
+{
+    return FString::Printf(TEXT("FFruitTickFunction[%s]"), *DebugName.ToString());
+}
+
+FName FFruitTickFunction::DiagnosticContext(bool bDetailed)
+{
+    return DebugName;
+}
\ No newline at end of file
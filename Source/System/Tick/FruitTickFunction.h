@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+
+/**
+ * 액터가 아닌 시스템(월드 서브시스템 등)을 원하는 틱 그룹에서 프레임당 한 번 실행하기 위한 틱 함수
+ * 예: 병합 큐는 물리 이후(TG_PostPhysics)에 한 번에 처리
+ */
+struct UE_FRUITMOUNTAIN_API FFruitTickFunction : public FTickFunction
+{
+    // 틱 등록 (레벨의 틱 목록에 추가)
+    void Setup(UWorld* World, ETickingGroup InTickGroup, TFunction<void(float)>&& InFunction, const TCHAR* InDebugName);
+
+    // 틱 해제
+    void Teardown();
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+    virtual FString DiagnosticMessage() override;
+
+    virtual FName DiagnosticContext(bool bDetailed) override;
+
+private:
+    // 매 틱마다 호출할 함수
+    TFunction<void(float)> Function;
+
+    // 진단용 이름
+    FName DebugName;
+};
\ No newline at end of file
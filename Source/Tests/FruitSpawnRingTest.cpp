@@ -0,0 +1,52 @@
+#include "Misc/AutomationTest.h"
+#include "Gameplay/Fruit/FruitSpawnRing.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// 임의 카메라 각도에서 링 조회가 직접 계산(기존 CalculatePlateEdgeSpawnPosition 식)과 허용 오차 안에서 같은지
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFruitSpawnRingMatchesExactTest, "FruitMountain.Fruit.SpawnRing.MatchesExact",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFruitSpawnRingMatchesExactTest::RunTest(const FString& Parameters)
+{
+    const int32 NumSamples = 10000;
+    const float MaxPositionError = 0.05f;
+
+    // 가상의 접시
+    const FVector Center(0.0f, 0.0f, 30.0f);
+    const float RimRadius = 60.0f;
+    const float BaseHeight = 40.0f;
+
+    FFruitSpawnRing Ring;
+    Ring.Build(Center, RimRadius, BaseHeight);
+    TestTrue(TEXT("링 구성"), Ring.IsValid());
+
+    // 음수/360도 이상 각도와 샘플 경계 각도도 포함
+    FRandomStream Random(1234);
+    TArray<float> Angles;
+    Angles.Reserve(NumSamples + 4);
+    Angles.Append({ 0.0f, 180.0f, 359.999f, -0.5f });
+    for (int32 Index = 0; Index < NumSamples; Index++)
+    {
+        Angles.Add(Random.FRandRange(-720.0f, 720.0f));
+    }
+
+    float MaxError = 0.0f;
+    float WorstAngle = 0.0f;
+    for (float Angle : Angles)
+    {
+        const FVector Exact = FFruitSpawnRing::EvaluateExact(Center, RimRadius, BaseHeight, Angle);
+        const float Error = FVector::Dist(Exact, Ring.GetSpawnLocation(Angle));
+        if (Error > MaxError)
+        {
+            MaxError = Error;
+            WorstAngle = Angle;
+        }
+    }
+
+    TestTrue(FString::Printf(TEXT("위치 오차 최대 %.4f cm (각도 %.3f, 허용 %.2f)"), MaxError, WorstAngle, MaxPositionError), MaxError <= MaxPositionError);
+    return true;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "Misc/AutomationTest.h"
+#include "Gameplay/Physics/FruitPhysicsHelper.h"
+#include "Gameplay/Physics/FruitTrajectoryHelper.h"
+#include "Gameplay/Fruit/FruitSpawnHelper.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FruitThrowSolverTest
+{
+    // 각도 간격과 허용 착지 오차 (목표 XY 기준, cm)
+    constexpr float AngleStep = 2.5f;
+    constexpr float MaxLandingError = 0.5f;
+
+    // 월드 없이 쓰는 가상의 접시 (접시 중심을 목표로 가장자리 바깥 위에서 던짐)
+    static FFruitThrowScene MakeScene()
+    {
+        FFruitThrowScene Scene;
+        Scene.Gravity = FMath::Abs(GetDefault<UPhysicsSettings>()->DefaultGravityZ);
+        Scene.PlateDisc.Center = FVector(0.0f, 0.0f, 20.0f);
+        Scene.PlateDisc.Radius = 100.0f;
+        Scene.PlateDisc.bValid = true;
+        Scene.PlateTopHeight = Scene.PlateDisc.Center.Z + 5.0f;
+        return Scene;
+    }
+
+    static const FVector Start(-150.0f, 0.0f, 120.0f);
+}
+
+// MinThrowAngle..MaxThrowAngle 모든 각도에서 닫힌 해가 접시에 떨어지고 목표 위치에 착지하는지
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFruitThrowSolverLandingTest, "FruitMountain.Physics.ThrowSolver.LandsOnTarget",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFruitThrowSolverLandingTest::RunTest(const FString& Parameters)
+{
+    using namespace FruitThrowSolverTest;
+
+    const FFruitThrowScene Scene = MakeScene();
+    const FVector Target = Scene.PlateDisc.Center;
+    const float BallMass = UFruitSpawnHelper::CalculateBallMass(1);
+
+    for (float Angle = UFruitPhysicsHelper::MinThrowAngle; Angle <= UFruitPhysicsHelper::MaxThrowAngle + KINDA_SMALL_NUMBER; Angle += AngleStep)
+    {
+        const FThrowPhysicsResult Result = UFruitPhysicsHelper::SolveThrow(Scene, Start, Target, Angle, BallMass);
+        TestTrue(FString::Printf(TEXT("각도 %.1f: 계산 성공"), Angle), Result.bSuccess);
+
+        float FlightTime = 0.0f;
+        FVector End;
+        const bool bLanded = UFruitTrajectoryHelper::SolveLanding(Start, Result.LaunchVelocity, -Scene.Gravity, Scene.PlateDisc, UFruitTrajectoryHelper::TrajectoryProbeRadius, FlightTime, End);
+        TestTrue(FString::Printf(TEXT("각도 %.1f: 접시에 착지"), Angle), bLanded);
+        TestTrue(FString::Printf(TEXT("각도 %.1f: 착지 오차 %.2f cm"), Angle, FVector::Dist2D(End, Target)), FVector::Dist2D(End, Target) <= MaxLandingError);
+    }
+
+    return true;
+}
+
+// 각도가 커질수록 궤적 최고점이 높아지는지 (미리보기 궤적과 실제 던지기가 같은 순서로 바뀌어야 함)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFruitThrowSolverPeakTest, "FruitMountain.Physics.ThrowSolver.PeakRisesWithAngle",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFruitThrowSolverPeakTest::RunTest(const FString& Parameters)
+{
+    using namespace FruitThrowSolverTest;
+
+    const FFruitThrowScene Scene = MakeScene();
+    const FVector Target = Scene.PlateDisc.Center;
+    const float BallMass = UFruitSpawnHelper::CalculateBallMass(1);
+
+    float PrevPeak = -1.0f;
+    for (float Angle = UFruitPhysicsHelper::MinThrowAngle; Angle <= UFruitPhysicsHelper::MaxThrowAngle + KINDA_SMALL_NUMBER; Angle += AngleStep)
+    {
+        const FThrowPhysicsResult Result = UFruitPhysicsHelper::SolveThrow(Scene, Start, Target, Angle, BallMass);
+        TestTrue(FString::Printf(TEXT("각도 %.1f: 최고점 %.1f >= 이전 %.1f"), Angle, Result.PeakHeight, PrevPeak), Result.PeakHeight >= PrevPeak);
+        PrevPeak = Result.PeakHeight;
+    }
+
+    return true;
+}
+
+#endif
\ No newline at end of file
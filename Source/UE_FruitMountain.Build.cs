@@ -19,6 +19,6 @@ public class UE_FruitMountain : ModuleRules
 			"AssetRegistry"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] {  });
+		PrivateDependencyModuleNames.AddRange(new string[] { "RenderCore" });
 	}
 }
@@ -1,4 +1,15 @@
 #include "UE_FruitMountain.h"
+#include "Gameplay/Fruit/FruitTypeCatalog.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE(FDefaultGameModuleImpl, UE_FruitMountain, "UE_FruitMountain");
\ No newline at end of file
+class FUE_FruitMountainModule : public FDefaultGameModuleImpl
+{
+public:
+    virtual void StartupModule() override
+    {
+        // 과일 타입 테이블 기본값은 조회 전에 게임 스레드에서 한 번 구움 (카탈로그 에셋이 로드되면 다시 구움)
+        FFruitTypeTable::Bake(nullptr);
+    }
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE(FUE_FruitMountainModule, UE_FruitMountain, "UE_FruitMountain");
\ No newline at end of file
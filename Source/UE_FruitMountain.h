@@ -0,0 +1,16 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// 과일 게임 전용 stat 그룹 (콘솔에서 "stat FruitMountain"으로 확인)
+DECLARE_STATS_GROUP(TEXT("FruitMountain"), STATGROUP_FruitMountain, STATCAT_Advanced);
+
+// 과일 전용 충돌 채널 (Config/DefaultEngine.ini의 CollisionProfile 설정과 맞춰야 함)
+// 과일 오브젝트 타입 - 과일 메시는 "Fruit" 프로필 사용
+#define ECC_Fruit ECC_GameTraceChannel1
+
+// 궤적 예측/검증 트레이스 채널 - 과일은 응답 설정으로 무시하므로 무시 목록이 필요 없음
+#define ECC_FruitPreview ECC_GameTraceChannel2
+
+// 과일 메시 충돌 프로필 이름
+#define FRUIT_COLLISION_PROFILE TEXT("Fruit")
\ No newline at end of file